@@ -2,14 +2,16 @@
 #include <stdlib.h>
 #include "raster-api.h"
 
-#define WINDOW_WIDTH 50
-#define WINDOW_HEIGHT 30
+#define WINDOW_WIDTH 800
+#define WINDOW_HEIGHT 240
 
 uint32_t framebuffer[WINDOW_HEIGHT * WINDOW_WIDTH];
 
 void draw_line_cb(uint16_t x, uint16_t y, uint16_t lenght, struct Color color) {
-    for (int i = 0; i < lenght; i++) {
-        framebuffer[y * WINDOW_WIDTH + x] = color.argb;
+    if (y >= WINDOW_HEIGHT)
+        return;
+    for (int i = 0; i < lenght && x + i < WINDOW_WIDTH; i++) {
+        framebuffer[y * WINDOW_WIDTH + x + i] = color.argb;
     }
 }
 
@@ -0,0 +1,35 @@
+#include <stdint.h>
+#include "framebuffer-api.h"
+#include "raster-api.h"
+
+#define WINDOW_WIDTH 800
+#define WINDOW_HEIGHT 240
+
+uint16_t pixels[WINDOW_HEIGHT * WINDOW_WIDTH];
+
+int main() {
+    struct RasterLabel v1;
+    raster_api_create_label(&v1, 
+                            (union RasterLabelData){ .float_val = 12.5f }, 
+                            LABEL_DATA_FLOAT,
+                            (union RasterLabelFormat){ .float_fmt = raster_api_float_format(1) },
+                            (struct RasterCoords){ 198, 60 }, 
+                            0, 
+                            100, 
+                            FONT_ALIGN_CENTER, 
+                            (struct Color){ .argb = 0xffffffff });
+
+    struct RasterBox boxes[] = {
+        { true, 0x1, { 2, 2, 397, 237 }, {.argb = 0xff202020}, &v1 },
+    };
+
+    struct Framebuffer fb;
+    framebuffer_api_init(&fb, pixels, WINDOW_WIDTH, WINDOW_HEIGHT, 0, FRAMEBUFFER_RGB565);
+
+    struct RasterHandler handler;
+    raster_api_init(&handler, boxes, 1, NULL, NULL, NULL);
+    framebuffer_api_bind(&handler, &fb);
+    framebuffer_api_clear(&fb, fb.clear_color);
+    raster_api_render(&handler);
+    return 0;
+}
@@ -15,6 +15,7 @@
 #ifndef FONTUTILS_API_H
 #define FONTUTILS_API_H
 
+#include <stdbool.h>
 #include "fontutils.h"
 #include "fonts.h"
 
@@ -35,6 +36,100 @@
  */
 void font_api_draw(uint16_t x, uint16_t y, enum FontAlign align, enum FontName font, const char *__restrict__ text, struct Color color, uint16_t size, font_draw_line_callback line_callback);
 
+/*!
+ * \brief Draws text in batches of spans
+ *
+ * \details Same as \c font_api_draw but instead of calling a callback for
+ *      every line, spans are stored in the buffer and flushed in batches.
+ *      The buffer is always flushed before returning.
+ *
+ * \param[in] x Position on x axis in buffer
+ * \param[in] y Position on y axis in buffer
+ * \param[in] align Alignment on x axis
+ * \param[in] font Font name described (uppercase)
+ * \param[in] text Pointer to text to draw
+ * \param[in] color ARGB color value (alpha is ignored)
+ * \param[in] size Of which size (vertically) the text is to be rendered
+ * \param[in,out] buffer Span buffer used to batch the output
+ */
+void font_api_draw_spans(uint16_t x, uint16_t y, enum FontAlign align, enum FontName font, const char *__restrict__ text, struct Color color, uint16_t size, struct FontSpanBuffer *buffer);
+
+/*!
+ * \brief Draws text using filled rectangles
+ *
+ * \details Same as \c font_api_draw but every scaled run is drawn as a single
+ *      rectangle, and identical runs on consecutive rows of the glyph are
+ *      merged into taller rectangles. Best suited for hardware fill engines.
+ *
+ * \param[in] x Position on x axis in buffer
+ * \param[in] y Position on y axis in buffer
+ * \param[in] align Alignment on x axis
+ * \param[in] font Font name described (uppercase)
+ * \param[in] text Pointer to text to draw
+ * \param[in] color ARGB color value (alpha is ignored)
+ * \param[in] size Of which size (vertically) the text is to be rendered
+ * \param[in] rectangle_callback Callback used to draw a rectangle
+ */
+void font_api_draw_rectangles(uint16_t x, uint16_t y, enum FontAlign align, enum FontName font, const char *__restrict__ text, struct Color color, uint16_t size, font_draw_rectangle_callback rectangle_callback);
+
+/*!
+ * \brief Draws text to a set of callbacks
+ *
+ * \details Generic version of the draw functions, the output used is chosen
+ *      as described in \c struct FontTarget. The span buffer of the target,
+ *      if any, is flushed before returning.
+ *
+ * \param[in] x Position on x axis in buffer
+ * \param[in] y Position on y axis in buffer
+ * \param[in] align Alignment on x axis
+ * \param[in] font Font name described (uppercase)
+ * \param[in] text Pointer to text to draw
+ * \param[in] color ARGB color value (alpha is ignored)
+ * \param[in] size Of which size (vertically) the text is to be rendered
+ * \param[in] target Callbacks used to draw the text
+ */
+void font_api_draw_target(uint16_t x, uint16_t y, enum FontAlign align, enum FontName font, const char *__restrict__ text, struct Color color, uint16_t size, const struct FontTarget *target);
+
+/*!
+ * \brief Flushes the spans stored in a buffer
+ *
+ * \param[in,out] buffer Span buffer to flush
+ */
+void font_api_flush_spans(struct FontSpanBuffer *buffer);
+
+/*!
+ * \brief Lays out a text
+ *
+ * \details Resolves the glyphs of the text and their pen positions in a
+ *      single pass, together with the total width used for alignment.
+ *
+ * \param[in] text The string to be laid out
+ * \param[in] font Which font to be used
+ * \param[in] size Of which size (vertically) the text is to be rendered
+ * \param[in,out] layout Layout with caller-provided glyph storage
+ *
+ * \return bool
+ *     - true if the text has been laid out
+ *     - false if the storage is too small
+ */
+bool font_api_layout(const char *__restrict__ text, enum FontName font, uint16_t size, struct FontLayout *layout);
+
+/*!
+ * \brief Draws a laid out text
+ *
+ * \details Draws the glyphs resolved by \c font_api_layout without looking
+ *      them up again. The span buffer of the target, if any, is flushed
+ *      before returning.
+ *
+ * \param[in] x Position on x axis in buffer
+ * \param[in] y Position on y axis in buffer
+ * \param[in] align Alignment on x axis
+ * \param[in] layout The laid out text
+ * \param[in] color ARGB color value (alpha is ignored)
+ * \param[in] target Callbacks used to draw the text
+ */
+void font_api_draw_layout(uint16_t x, uint16_t y, enum FontAlign align, const struct FontLayout *layout, struct Color color, const struct FontTarget *target);
+
 /*!
  * \brief Calculate the length of the text in pixel
  *
@@ -47,4 +142,77 @@ void font_api_draw(uint16_t x, uint16_t y, enum FontAlign align, enum FontName f
  */
 uint16_t font_api_length(const char *__restrict__ text, uint16_t size, enum FontName font);
 
+/*!
+ * \brief Computes the opaque colors of a text drawn over a solid background
+ *
+ * \details Every entry is the text color blended over the background with
+ *      the coverage of its index, with full alpha. Used as palette of a
+ *      FontTarget, text is emitted as opaque pixels that need no blending.
+ *
+ * \param[in] color Color of the text
+ * \param[in] background Color of the background
+ * \param[out] palette Array of FONT_PALETTE_SIZE colors to fill
+ */
+void font_api_blend_palette(struct Color color, struct Color background, uint32_t *palette);
+
+/*!
+ * \brief Initializes a glyph cache over caller-provided storage
+ *
+ * \details A glyph drawn at a given size takes one entry and one run for
+ *      every run of its generated data, split at row ends.
+ *
+ * \param[out] cache Pointer to the FontGlyphCache struct to initialize
+ * \param[in] entries Storage for the cached glyphs
+ * \param[in] entry_capacity Number of glyphs the storage can hold
+ * \param[in] runs Storage for the runs of the cached glyphs
+ * \param[in] run_capacity Number of runs the storage can hold
+ */
+void font_api_glyph_cache_init(struct FontGlyphCache *cache, struct FontGlyphCacheEntry *entries, uint16_t entry_capacity, struct FontGlyphRun *runs, uint32_t run_capacity);
+
+/*!
+ * \brief Removes every glyph from a glyph cache
+ *
+ * \param[in,out] cache Pointer to the FontGlyphCache struct to clear
+ */
+void font_api_glyph_cache_clear(struct FontGlyphCache *cache);
+
+/*!
+ * \brief Loads a binary font pack and registers its fonts
+ *
+ * \details Every offset, size and glyph of the pack is validated before the
+ *      storage is written and any font is registered. The fonts of the pack are then drawn as any
+ *      generated font, with the FontName returned by font_api_pack_find().
+ *      A single pack is registered at a time: loading a new one replaces the
+ *      fonts of the previous one, so glyph caches and laid out labels using
+ *      them must be cleared. The storage of the registered pack must not be
+ *      reused to load the new one.
+ *
+ * \param[out] pack Pointer to the FontPack struct to initialize
+ * \param[in] data Pointer to the pack in memory, 4 bytes aligned
+ * \param[in] size Size of the pack in bytes
+ * \param[in] font_storage Storage for the fonts of the pack
+ * \param[in] font_capacity Number of fonts the storage can hold
+ * \param[in] level_storage Storage for the glyph levels of the pack
+ * \param[in] level_capacity Number of glyph levels the storage can hold
+ *
+ * \return bool
+ *      - true if the pack is valid and its fonts are registered
+ *      - false otherwise, the storage and the fonts registered before are
+ *        untouched
+ */
+bool font_api_pack_load(struct FontPack *pack, const void *data, uint32_t size, struct Font *font_storage, uint8_t font_capacity, struct FontLevel *level_storage, uint16_t level_capacity);
+
+/*!
+ * \brief Finds a font of a registered font pack by name
+ *
+ * \param[in] pack Pointer to the registered pack
+ * \param[in] name Name of the font in the generator configuration
+ * \param[out] font Name enumeration to draw the font with
+ *
+ * \return bool
+ *      - true if the pack has a font with this name
+ *      - false otherwise
+ */
+bool font_api_pack_find(const struct FontPack *pack, const char *name, enum FontName *font);
+
 #endif // FONTUTILS_API_H
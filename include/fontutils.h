@@ -10,6 +10,8 @@
 #define FONTUTILS_H
 
 #include "colors.h"
+#include "fonts.h"
+#include <stdbool.h>
 #include <stdint.h>
 
 // Include raster-config.h if it exists
@@ -30,6 +32,28 @@
 #define RASTER_PARTIAL (1)
 #endif
 
+#ifndef RASTER_FIXED_POINT
+/*!
+ * \brief Use Q16.16 fixed point math to scale glyphs
+ *
+ * \details When enabled, the scaling factor is computed once per draw in
+ *     fixed point and runs are scaled with integer math only, avoiding the
+ *     FPU (or its software emulation). Positions may differ by at most one
+ *     pixel from the floating point path, when a scaled coordinate falls
+ *     within 1/65536 of a pixel boundary.
+ *     Scaling factors must be lower than 256.
+ */
+#define RASTER_FIXED_POINT (0)
+#endif
+
+/*!
+ * \brief Number of coverage levels of the generated glyphs
+ *
+ * \details Glyph coverage is stored in 4 bits, so a palette of this size
+ *     holds a color for every possible pixel of a text.
+ */
+#define FONT_PALETTE_SIZE (16)
+
 /*!
  * \brief Callback type for drawing a horizontal line of pixels
  *
@@ -45,6 +69,157 @@
  */
 typedef void (*font_draw_line_callback)(uint16_t x, uint16_t y, uint16_t lenght, struct Color color);
 
+/*!
+ * \brief Callback type for drawing a filled rectangle of text pixels
+ *
+ * \details Used to draw scaled runs of a glyph in a single call. The
+ *      coverage of the pixels is stored in the alpha channel of the color.
+ *
+ * \param[in] x X position of the rectangle
+ * \param[in] y Y position of the rectangle
+ * \param[in] w Width of the rectangle
+ * \param[in] h Height of the rectangle
+ * \param[in] color Color of the rectangle (ARGB format)
+ */
+typedef void (*font_draw_rectangle_callback)(uint16_t x, uint16_t y, uint16_t w, uint16_t h, struct Color color);
+
+/*!
+ * \brief Represents a horizontal run of pixels produced by the text renderer
+ */
+struct FontSpan {
+    uint16_t x;         /*!< X position of the first pixel */
+    uint16_t y;         /*!< Y position of the span */
+    uint16_t length;    /*!< Number of pixels in the span */
+    struct Color color; /*!< Color of the span, coverage stored in the alpha channel */
+};
+
+/*!
+ * \brief Callback type for drawing a batch of spans
+ *
+ * \details This callback receives many spans in a single call, so that the
+ *      call and hardware setup overhead can be amortized over the batch.
+ *
+ * \param[in] spans Array of spans to draw
+ * \param[in] count Number of spans in the array
+ */
+typedef void (*font_draw_spans_callback)(const struct FontSpan *spans, uint16_t count);
+
+/*!
+ * \brief Caller-provided storage used to batch spans
+ *
+ * \details Spans are accumulated in \c spans and handed to \c callback
+ *      every time the buffer fills up and at the end of every draw.
+ */
+struct FontSpanBuffer {
+    struct FontSpan *spans;            /*!< Pointer to the span storage */
+    uint16_t capacity;                 /*!< Number of spans the storage can hold */
+    uint16_t count;                    /*!< Number of spans currently stored */
+    font_draw_spans_callback callback; /*!< Callback used to flush the spans */
+};
+
+/*!
+ * \brief Area of the screen text pixels are restricted to
+ */
+struct FontClip {
+    uint16_t x; /*!< X position of the area */
+    uint16_t y; /*!< Y position of the area */
+    uint16_t w; /*!< Width of the area */
+    uint16_t h; /*!< Height of the area */
+};
+
+/*!
+ * \brief Decoded and scaled run of pixels of a glyph
+ *
+ * \details For targets drawing rectangles, runs of consecutive rows are
+ *      already merged into rectangles.
+ */
+struct FontGlyphRun {
+    uint16_t x;    /*!< X offset from the glyph position */
+    uint16_t y;    /*!< Y offset from the glyph position */
+    uint16_t w;    /*!< Width of the run */
+    uint16_t h;    /*!< Height of the run */
+    uint16_t row;  /*!< Last source row of the run inside the glyph */
+    uint8_t value; /*!< Coverage of the run */
+};
+
+/*!
+ * \brief Glyph stored inside a glyph cache
+ */
+struct FontGlyphCacheEntry {
+    uint32_t first;     /*!< Position of the first run in the run storage */
+    uint32_t last_used; /*!< Value of the cache clock when last drawn */
+    uint16_t count;     /*!< Number of runs of the glyph */
+    uint16_t size;      /*!< Size the runs are scaled to */
+    enum FontName font; /*!< Font of the glyph */
+    uint8_t glyph;      /*!< Index of the glyph inside the font */
+    bool merged;        /*!< Flag to indicate if the runs are merged into rectangles */
+};
+
+/*!
+ * \brief Least recently used cache of decoded and scaled glyphs
+ *
+ * \details Both arrays are provided by the caller. Entries are kept in the
+ *      order of their runs, which are packed at the start of the run storage.
+ *      When a new glyph does not fit, the least recently drawn glyphs are
+ *      evicted. Glyphs bigger than the whole storage are decoded directly.
+ */
+struct FontGlyphCache {
+    struct FontGlyphCacheEntry *entries; /*!< Pointer to the entry storage */
+    uint16_t entry_capacity;             /*!< Number of entries the storage can hold */
+    uint16_t entry_count;                /*!< Number of cached glyphs */
+    struct FontGlyphRun *runs;           /*!< Pointer to the run storage */
+    uint32_t run_capacity;               /*!< Number of runs the storage can hold */
+    uint32_t run_count;                  /*!< Number of runs used by the cached glyphs */
+    uint32_t clock;                      /*!< Counter incremented at every lookup */
+    uint32_t hits;                       /*!< Number of glyphs drawn from the cache */
+    uint32_t misses;                     /*!< Number of glyphs decoded */
+};
+
+/*!
+ * \brief Set of callbacks receiving the pixels produced by the text renderer
+ *
+ * \details Only one output is used: the span buffer if set, otherwise the
+ *      rectangle callback if set, otherwise the line callback.
+ *      When a clip area is set, pixels outside of it are never emitted.
+ *      When a palette is set, pixels take its colors instead of the text
+ *      color with the coverage in the alpha channel.
+ *      When a glyph cache is set, glyphs are decoded once per size and then
+ *      drawn from the cache.
+ */
+struct FontTarget {
+    font_draw_line_callback line_callback;           /*!< Callback used to draw a single line */
+    font_draw_rectangle_callback rectangle_callback; /*!< Callback used to draw a scaled run (can be NULL) */
+    struct FontSpanBuffer *span_buffer;              /*!< Buffer used to batch spans (can be NULL) */
+    const struct FontClip *clip;                     /*!< Area the pixels are restricted to (can be NULL) */
+    const uint32_t *palette;                         /*!< FONT_PALETTE_SIZE colors indexed by coverage / 16 (can be NULL) */
+    struct FontGlyphCache *glyph_cache;              /*!< Cache of decoded glyphs (can be NULL) */
+};
+
+/*!
+ * \brief Position of a single glyph inside a laid out text
+ */
+struct FontLayoutGlyph {
+    uint16_t x;    /*!< Pen position relative to the start of the text */
+    uint8_t index; /*!< Index of the glyph inside the font */
+};
+
+/*!
+ * \brief Result of laying out a text
+ *
+ * \details Glyphs are resolved once and stored in the caller-provided array,
+ *      so that the same text can be aligned and drawn without looking up
+ *      the glyphs again.
+ */
+struct FontLayout {
+    struct FontLayoutGlyph *glyphs; /*!< Pointer to the glyph storage */
+    uint16_t capacity;              /*!< Number of glyphs the storage can hold */
+    uint16_t count;                 /*!< Number of glyphs laid out */
+    uint16_t width;                 /*!< Width of the text in pixels */
+    uint16_t end;                   /*!< Pen position after the last glyph */
+    enum FontName font;             /*!< Font used for the layout */
+    uint16_t size;                  /*!< Size used for the layout */
+};
+
 /*!
  * \brief Represents the alignment of the rendering of the text
  *
@@ -57,4 +232,33 @@ enum FontAlign {
     FONT_ALIGN_RIGHT   /*!< Right alignment */
 };
 
+/*!
+ * \brief Version of the binary font pack format read by the loader
+ */
+#define FONT_PACK_VERSION (1)
+
+/*!
+ * \brief Size of the name field of a font in a binary font pack
+ *
+ * \details Names are NUL padded, so they are at most one character shorter.
+ */
+#define FONT_PACK_NAME_SIZE (16)
+
+/*!
+ * \brief Fonts loaded from a binary font pack
+ *
+ * \details Glyphs, glyph data and glyph indexes are used in place from the
+ *      pack memory, which must stay valid and unchanged while the fonts are
+ *      registered. Only the Font and FontLevel structures, which hold
+ *      pointers, are built in the given storage.
+ */
+struct FontPack {
+    const uint8_t *data;      /*!< Pointer to the pack in memory */
+    uint32_t size;            /*!< Size of the pack in bytes */
+    struct Font *fonts;       /*!< Storage of the fonts of the pack */
+    uint8_t font_count;       /*!< Number of fonts in the pack */
+    struct FontLevel *levels; /*!< Storage of the glyph levels of every font */
+    uint16_t level_count;     /*!< Number of glyph levels in the pack */
+};
+
 #endif // FONTUTILS_H
@@ -0,0 +1,75 @@
+/*!
+ * \file framebuffer-api.h
+ * \date 2026-10-16
+ * \author Alessandro Bridi [ale.bridi15@gmail.com]
+ *
+ * \brief Software framebuffer backend API functions
+ *
+ * \details Every drawing function blends the color over the framebuffer
+ *      using its alpha channel, which holds the coverage of text pixels, and
+ *      clips to the framebuffer bounds.
+ */
+
+#ifndef FRAMEBUFFER_API_H
+#define FRAMEBUFFER_API_H
+
+#include "framebuffer.h"
+#include "raster.h"
+
+/*!
+ * \brief Initializes a framebuffer over the given memory
+ *
+ * \param[out] fb Pointer to the Framebuffer struct to initialize
+ * \param[in] pixels Pointer to the pixel memory
+ * \param[in] width Width in pixels
+ * \param[in] height Height in pixels
+ * \param[in] stride Distance in bytes between two rows, 0 for packed rows
+ * \param[in] format Format of the pixels
+ */
+void framebuffer_api_init(struct Framebuffer *fb, void *pixels, uint16_t width, uint16_t height, uint32_t stride, enum FramebufferFormat format);
+
+/*!
+ * \brief Sets the callbacks of a handler to draw on a framebuffer
+ *
+ * \details The callbacks have no context argument, so a single framebuffer
+ *      can be bound at a time: binding a new one redirects every handler
+ *      bound before.
+ *
+ * \param[in,out] hras Pointer to the RasterHandler struct to modify
+ * \param[in] fb Pointer to the framebuffer to draw on
+ */
+void framebuffer_api_bind(struct RasterHandler *hras, struct Framebuffer *fb);
+
+/*!
+ * \brief Draws a rectangle on a framebuffer
+ *
+ * \details Opaque colors are filled, translucent ones blended.
+ *
+ * \param[in,out] fb Pointer to the framebuffer
+ * \param[in] x X position of the rectangle
+ * \param[in] y Y position of the rectangle
+ * \param[in] w Width of the rectangle
+ * \param[in] h Height of the rectangle
+ * \param[in] color Color of the rectangle (ARGB format)
+ */
+void framebuffer_api_fill(struct Framebuffer *fb, uint16_t x, uint16_t y, uint16_t w, uint16_t h, struct Color color);
+
+/*!
+ * \brief Fills the whole framebuffer with a color, ignoring its alpha
+ *
+ * \param[in,out] fb Pointer to the framebuffer
+ * \param[in] color Color to fill with
+ */
+void framebuffer_api_clear(struct Framebuffer *fb, struct Color color);
+
+/*!
+ * \brief Span batch callback drawing on the bound framebuffer
+ *
+ * \details Can be used as callback of a FontSpanBuffer.
+ *
+ * \param[in] spans Array of spans to draw
+ * \param[in] count Number of spans in the array
+ */
+void framebuffer_api_draw_spans(const struct FontSpan *spans, uint16_t count);
+
+#endif // FRAMEBUFFER_API_H
@@ -0,0 +1,60 @@
+/*!
+ * \file framebuffer.h
+ * \date 2026-10-16
+ * \author Alessandro Bridi [ale.bridi15@gmail.com]
+ *
+ * \brief Software framebuffer backend structures and types
+ *
+ * \details Reference implementation of the drawing callbacks over a
+ *     framebuffer in memory, useful for simulators, desktop tools and as a
+ *     baseline to compare hardware backends against.
+ */
+
+#ifndef FRAMEBUFFER_H
+#define FRAMEBUFFER_H
+
+#include <stdint.h>
+#include "colors.h"
+
+// Include raster-config.h if it exists
+#ifdef __has_include
+#if __has_include("raster-config.h")
+#include "raster-config.h"
+#endif
+#endif
+
+#ifndef RASTER_FRAMEBUFFER_SIMD
+/*!
+ * \brief Use SIMD instructions to fill and blend framebuffer rows
+ *
+ * \details When enabled, ARGB8888 fills and blends use AVX2 or SSE2 on x86
+ *     and NEON on ARM, and RGB565 ones SSE2 or NEON, depending on the
+ *     instruction sets enabled at compile time. The scalar code is used
+ *     otherwise and for L8 blends.
+ *     Both paths produce exactly the same pixels.
+ */
+#define RASTER_FRAMEBUFFER_SIMD (1)
+#endif
+
+/*!
+ * \brief Pixel formats supported by the framebuffer backend
+ */
+enum FramebufferFormat {
+    FRAMEBUFFER_ARGB8888, /*!< 32 bits per pixel, same layout as struct Color */
+    FRAMEBUFFER_RGB565,   /*!< 16 bits per pixel, no alpha */
+    FRAMEBUFFER_L8        /*!< 8 bits per pixel luminance, no alpha */
+};
+
+/*!
+ * \brief Framebuffer in memory drawn by the software backend
+ */
+struct Framebuffer {
+    void *pixels;                  /*!< Pointer to the first pixel of the first row */
+    uint16_t width;                /*!< Width in pixels */
+    uint16_t height;               /*!< Height in pixels */
+    uint32_t stride;               /*!< Distance in bytes between two rows */
+    enum FramebufferFormat format; /*!< Format of the pixels */
+    struct Color clear_color;      /*!< Color used by the clear screen callback */
+};
+
+#endif // FRAMEBUFFER_H
@@ -15,6 +15,7 @@
 #ifndef RASTER_API_H
 #define RASTER_API_H
 
+#include <stddef.h>
 #include "raster.h"
 
 /*!
@@ -22,15 +23,16 @@
  *
  * \details Sets the callbacks inside the RasterHandler struct
  *     passed as argument.
- *     Clear screen callback is optional, and can be set to NULL when RASTER_PARTIAL
- *     is equal to 1.
+ *     Clear screen callback is optional, and can be set to NULL: the
+ *     screen is then never cleared, also when RASTER_PARTIAL is equal to 0,
+ *     and every box is drawn over the previous frame.
  *
  * \param[out] hras Pointer to the RasterHandler struct to initialize
  * \param[in] interface Pointer to the defined interface
  * \param[in] size Number of boxes in the interface
  * \param[in] draw_line Draw line callback
  * \param[in] draw_rectangle Draw rectangle callback
- * \param[in] clear_screen Clear screen callback
+ * \param[in] clear_screen Clear screen callback (can be NULL)
  */
 void raster_api_init(struct RasterHandler *hras, struct RasterBox *interface, uint16_t size, font_draw_line_callback draw_line, raster_draw_rectangle_callback draw_rectangle, raster_clear_screen_callback clear_screen);
 
@@ -46,11 +48,69 @@ void raster_api_init(struct RasterHandler *hras, struct RasterBox *interface, ui
  */
 void raster_api_set_interface(struct RasterHandler *hras, struct RasterBox *interface, uint16_t size);
 
+/*!
+ * \brief Sets the span buffer used to batch text rendering
+ *
+ * \details When a span buffer is set, text is drawn through its batch
+ *     callback instead of the draw line callback, which is kept as a
+ *     fallback when the buffer is NULL.
+ *
+ * \param[out] hras Pointer to the RasterHandler struct to modify
+ * \param[in] buffer Pointer to the span buffer (can be NULL)
+ */
+void raster_api_set_span_buffer(struct RasterHandler *hras, struct FontSpanBuffer *buffer);
+
+/*!
+ * \brief Sets the callback used to draw text as rectangles
+ *
+ * \details When set, scaled glyph runs are drawn as rectangles, merging
+ *     identical runs of consecutive rows, instead of one draw line call
+ *     per output row. The callback must honor the alpha channel, which
+ *     holds the coverage of the pixels. Ignored when a span buffer is set.
+ *
+ * \param[out] hras Pointer to the RasterHandler struct to modify
+ * \param[in] draw_text_rectangle Draw rectangle callback (can be NULL)
+ */
+void raster_api_set_text_rectangle_callback(struct RasterHandler *hras, font_draw_rectangle_callback draw_text_rectangle);
+
+/*!
+ * \brief Enables pre-blending of text over the box background
+ *
+ * \details When enabled, the text of boxes with an opaque background is
+ *     blended with the background by the renderer and emitted with full
+ *     alpha, so callbacks can write pixels without reading them back.
+ *     Boxes with a translucent background still emit the coverage in the
+ *     alpha channel.
+ *
+ * \param[out] hras Pointer to the RasterHandler struct to modify
+ * \param[in] enable True to emit opaque text pixels
+ */
+void raster_api_set_opaque_text(struct RasterHandler *hras, bool enable);
+
+/*!
+ * \brief Sets the cache used to draw the glyphs of the labels
+ *
+ * \details Glyphs are decoded and scaled once per size, then drawn from the
+ *     cache until evicted. The cache is not used by the threads of
+ *     raster_api_render_parallel().
+ *
+ * \param[out] hras Pointer to the RasterHandler struct to modify
+ * \param[in] cache Pointer to an initialized glyph cache, NULL to disable it
+ */
+void raster_api_set_glyph_cache(struct RasterHandler *hras, struct FontGlyphCache *cache);
+
 /*!
  * \brief Renders the whole interface
  *
  * \details For every box, draws it using the callbacks that are passed
- *      as arguments to the function.
+ *      as arguments to the function. The \c updated flag of every drawn box
+ *      is cleared.
+ *
+ *      Boxes completely covered by a single opaque box later in the
+ *      interface are not drawn, and their \c updated flag is cleared too:
+ *      mark them as updated when the cover moves or goes away. In partial
+ *      mode, redrawing a box marks the later boxes overlapping it as
+ *      updated, so that they are drawn again on top of it.
  *
  *      The signature of the function changes based on the \c RASTER_PARTIAL
  *      env variable, adding or removing the \c clear_screen callback.
@@ -61,6 +121,105 @@ void raster_api_set_interface(struct RasterHandler *hras, struct RasterBox *inte
  */
 void raster_api_render(struct RasterHandler *hras);
 
+/*!
+ * \brief Renders only the part of the interface inside a region
+ *
+ * \details Every box intersecting the region is drawn, whether updated or
+ *      not, unless the part inside the region is covered by a later opaque
+ *      box. Every rectangle and text pixel is clipped to the region, so
+ *      that the screen can be rendered band by band into a buffer smaller
+ *      than the screen. The area of the region not covered by boxes is left
+ *      untouched.
+ *
+ *      The \c updated flags, the damage list and the update queue are left
+ *      untouched, so labels must not change between the bands of a frame.
+ *
+ * \param[in] hras Pointer to the RasterHandler struct to use
+ * \param[in] region The area of the screen to render
+ */
+void raster_api_render_region(struct RasterHandler *hras, const struct RasterRect *region);
+
+/*!
+ * \brief Renders the interface splitting the screen in tiles drawn in parallel
+ *
+ * \details The screen is split in tiles rendered with
+ *      raster_api_render_region() by the calling thread and the workers set
+ *      with raster_api_set_workers(), without any lock: tiles are disjoint,
+ *      so the callbacks must only be able to draw different pixels at the
+ *      same time, as a framebuffer in memory does. Text is drawn without the
+ *      span buffer. Without workers, or with \c RASTER_THREADS of 0 or 1,
+ *      the calling thread draws every tile.
+ *
+ *      In partial mode only the tiles overlapping an updated box are drawn,
+ *      and every box inside them is redrawn. Labels are laid out before the
+ *      threads start, and the \c updated flags, the damage list and the
+ *      update queue are handled as in raster_api_render().
+ *
+ * \param[in] hras Pointer to the RasterHandler struct to use
+ * \param[in] screen The area of the screen to render
+ * \param[in] tile_width Width of a tile
+ * \param[in] tile_height Height of a tile
+ */
+void raster_api_render_parallel(struct RasterHandler *hras, const struct RasterRect *screen, uint16_t tile_width, uint16_t tile_height);
+
+/*!
+ * \brief Starts the worker threads of the tile renderer
+ *
+ * \details \c RASTER_THREADS minus one threads are started, as the thread
+ *      calling raster_api_render_parallel() draws tiles too. They wait for
+ *      frames without spinning. Threads that cannot be created are left
+ *      out of \c count. With \c RASTER_THREADS of 0 or 1 no thread is
+ *      started.
+ *
+ * \param[out] workers Pointer to the RasterWorkers struct to initialize
+ *
+ * \return bool
+ *      - true if the workers can be used, even with no thread started
+ *      - false if the locks could not be created
+ */
+bool raster_api_workers_init(struct RasterWorkers *workers);
+
+/*!
+ * \brief Stops and joins the worker threads of the tile renderer
+ *
+ * \details Must be called once for every successful
+ *      raster_api_workers_init(), when no render uses the workers.
+ *
+ * \param[in,out] workers Pointer to the RasterWorkers struct to stop
+ */
+void raster_api_workers_destroy(struct RasterWorkers *workers);
+
+/*!
+ * \brief Sets the worker threads drawing the tiles of the handler
+ *
+ * \details The same workers can be shared by several handlers, as long as
+ *      their renders do not run at the same time.
+ *
+ * \param[out] hras Pointer to the RasterHandler struct to modify
+ * \param[in] workers Pointer to initialized workers, NULL to draw on the calling thread only
+ */
+void raster_api_set_workers(struct RasterHandler *hras, struct RasterWorkers *workers);
+
+/*!
+ * \brief Retrieves the areas redrawn by the last render
+ *
+ * \details After \c raster_api_render the handler holds a bounded list of
+ *      merged rectangles covering every box that was redrawn, so that only
+ *      the changed pixels have to be flushed to the display.
+ *
+ *      When \c RASTER_PARTIAL is 0 the screen is cleared on every render,
+ *      so the whole screen has to be flushed and no list is returned.
+ *
+ * \param[in] hras Pointer to the RasterHandler struct to use
+ * \param[out] rects Pointer set to the array of damage rectangles
+ * \param[out] count Number of rectangles in the array
+ *
+ * \return bool
+ *     - true if the list describes the damaged area
+ *     - false if the whole screen must be considered damaged
+ */
+bool raster_api_get_damage(const struct RasterHandler *hras, const struct RasterRect **rects, uint16_t *count);
+
 /*!
  * \brief Utility to get a Box based on id value
  *
@@ -76,6 +235,35 @@ void raster_api_render(struct RasterHandler *hras);
  */
 struct RasterBox *raster_api_get_box(struct RasterBox *boxes, uint16_t num, uint16_t id);
 
+/*!
+ * \brief Sets the storage used to index boxes by id
+ *
+ * \details Builds an index of the interface sorted by box id in the given
+ *     storage, which is rebuilt every time the interface is changed with
+ *     \c raster_api_set_interface. If the storage is too small for the
+ *     interface the index is not used.
+ *
+ * \param[in,out] hras Pointer to the RasterHandler struct to modify
+ * \param[in] storage Array of at least \c size entries (can be NULL)
+ * \param[in] capacity Number of entries of the storage
+ */
+void raster_api_set_index(struct RasterHandler *hras, uint16_t *storage, uint16_t capacity);
+
+/*!
+ * \brief Gets a Box of the handler interface based on id value
+ *
+ * \details Uses a binary search on the index when available, otherwise
+ *      falls back to \c raster_api_get_box.
+ *
+ * \param[in] hras Pointer to the RasterHandler struct to use
+ * \param[in] id ID of the box to search for
+ *
+ * \return struct RasterBox*
+ *     - Box pointer if found
+ *     - NULL if not found
+ */
+struct RasterBox *raster_api_find_box(const struct RasterHandler *hras, uint16_t id);
+
 /*!
  * \brief Utility to populate struct Label
  *
@@ -94,19 +282,160 @@ void raster_api_create_label(struct RasterLabel *label, union RasterLabelData va
 /*!
  * \brief Utility to set label data inside a Box
  *
+ * \details The box is marked as updated only when the formatted value differs
+ *      from the last rendered one (e.g. a float with precision 2 changing from
+ *      12.341 to 12.344 leaves the box untouched).
+ *
  * \param[in,out] box The box to modify
  * \param[in] value Union of possible value types
  */
 void raster_api_set_label_data(struct RasterBox *box, union RasterLabelData value);
 
+/*!
+ * \brief Initializes a spatial grid over caller-provided storage
+ *
+ * \details The grid needs one cell offset per cell plus one, and one entry
+ *      for every cell touched by every box.
+ *
+ * \param[out] grid Pointer to the RasterGrid struct to initialize
+ * \param[in] cells Storage of the cell offsets
+ * \param[in] cell_capacity Number of offsets the cells storage can hold
+ * \param[in] entries Storage of the box positions
+ * \param[in] entry_capacity Number of positions the entries storage can hold
+ * \param[in] cell_shift Cells are 2^cell_shift pixels wide and tall
+ */
+void raster_api_grid_init(struct RasterGrid *grid, uint16_t *cells, uint16_t cell_capacity, uint16_t *entries, uint16_t entry_capacity, uint8_t cell_shift);
+
+/*!
+ * \brief Sets the spatial grid of the handler and builds it
+ *
+ * \details The grid is rebuilt every time the interface is changed with
+ *      \c raster_api_set_interface. Call this again after moving or
+ *      resizing boxes. If the storage is too small the grid is not used and
+ *      queries scan the whole interface.
+ *
+ * \param[in,out] hras Pointer to the RasterHandler struct to modify
+ * \param[in,out] grid Pointer to an initialized grid (can be NULL)
+ */
+void raster_api_set_grid(struct RasterHandler *hras, struct RasterGrid *grid);
+
+/*!
+ * \brief Finds the boxes intersecting a rectangle
+ *
+ * \details Positions are stored in interface order. When more boxes than
+ *      \c capacity intersect the rectangle, only \c capacity of them are
+ *      stored.
+ *
+ * \param[in] hras Pointer to the RasterHandler struct to use
+ * \param[in] rect The area to search
+ * \param[out] positions Positions of the boxes inside the interface
+ * \param[in] capacity Number of positions that can be stored
+ *
+ * \return uint16_t Number of boxes intersecting the rectangle
+ */
+uint16_t raster_api_query_rect(const struct RasterHandler *hras, const struct RasterRect *rect, uint16_t *positions, uint16_t capacity);
+
+/*!
+ * \brief Finds the topmost box containing a point
+ *
+ * \param[in] hras Pointer to the RasterHandler struct to use
+ * \param[in] x X position of the point
+ * \param[in] y Y position of the point
+ *
+ * \return struct RasterBox* Pointer to the last box of the interface containing the point, or NULL
+ */
+struct RasterBox *raster_api_box_at(const struct RasterHandler *hras, uint16_t x, uint16_t y);
+
+/*!
+ * \brief Applies many label data updates in one call
+ *
+ * \details The updates are sorted by id (the array is reordered) and matched
+ *      against the interface in a single pass, using the index when available.
+ *      When the same id appears more than once only its last value, in array
+ *      order, is applied. Boxes are marked as updated only on visible changes,
+ *      as with \c raster_api_set_label_data.
+ *
+ * \param[in,out] hras Pointer to the RasterHandler struct to use
+ * \param[in,out] updates Array of updates, sorted in place
+ * \param[in] count Number of updates in the array
+ *
+ * \return uint16_t Number of boxes found and updated
+ */
+uint16_t raster_api_apply_updates(struct RasterHandler *hras, struct RasterUpdate *updates, uint16_t count);
+
+/*!
+ * \brief Initializes an update queue over the given storage
+ *
+ * \param[out] queue Pointer to the queue to initialize
+ * \param[in] storage Array of updates used as ring buffer
+ * \param[in] capacity Number of entries of the storage, must be a power of two
+ *
+ * \return bool True if the queue was initialized, false on invalid arguments
+ */
+bool raster_api_queue_init(struct RasterUpdateQueue *queue, struct RasterUpdate *storage, uint16_t capacity);
+
+/*!
+ * \brief Pushes a label update into the queue
+ *
+ * \details Must be called by a single producer thread. No locks are taken.
+ *     The string pointed by a text update must stay valid until rendered.
+ *
+ * \param[in,out] queue Pointer to the queue
+ * \param[in] id Identifier of the box to update
+ * \param[in] data New content of the label
+ *
+ * \return bool True if the update was queued, false if the queue is full
+ */
+bool raster_api_queue_push(struct RasterUpdateQueue *queue, uint16_t id, union RasterLabelData data);
+
+/*!
+ * \brief Applies all the updates waiting in the queue
+ *
+ * \details Must be called by the single consumer thread, which is the one
+ *     rendering. Called automatically by \c raster_api_render when a queue
+ *     is set on the handler.
+ *
+ * \param[in,out] hras Pointer to the RasterHandler struct to use
+ * \param[in,out] queue Pointer to the queue to drain
+ *
+ * \return uint16_t Number of updates applied to existing boxes
+ */
+uint16_t raster_api_queue_drain(struct RasterHandler *hras, struct RasterUpdateQueue *queue);
+
+/*!
+ * \brief Sets the update queue drained at the start of every render
+ *
+ * \param[out] hras Pointer to the RasterHandler struct to modify
+ * \param[in] queue Pointer to the queue (can be NULL)
+ */
+void raster_api_set_update_queue(struct RasterHandler *hras, struct RasterUpdateQueue *queue);
+
 /*!
  * \brief Utility to update label formatting options
  *
+ * \details The box is marked as updated only when the formatted value differs
+ *      from the last rendered one.
+ *
  * \param[in,out] box The box to modify
  * \param[in] format Formatting options for the value
  */
 void raster_api_set_label_format(struct RasterBox *box, union RasterLabelFormat format);
 
+/*!
+ * \brief Formats the data of a label into a string
+ *
+ * \details Formats the label data according to its type and formatting
+ *      options. Numbers are formatted without the C library printf, with the
+ *      same output as \c "%" \c PRId32, \c "%" \c PRIu32 and \c "%.*f";
+ *      float precision is clamped to \c RASTER_MAX_FLOAT_PRECISION.
+ *      The output is truncated to the buffer size.
+ *
+ * \param[in] label Pointer to the RasterLabel structure
+ * \param[out] buffer Buffer to store the formatted string
+ * \param[in] buffer_size Size of the buffer
+ */
+void raster_api_format_label(const struct RasterLabel *label, char *buffer, size_t buffer_size);
+
 /*!
  * \brief Helper to create default integer formatting options
  *
@@ -14,6 +14,61 @@
 #include "fontutils.h"
 #include "fonts.h"
 
+#ifndef RASTER_MAX_DAMAGE_RECTS
+/*!
+ * \brief Maximum number of damage rectangles tracked per render
+ *
+ * \details Rectangles redrawn during a render are merged together when they
+ *     overlap or touch. When the list is full the new area is merged into
+ *     the rectangle that grows the least.
+ */
+#define RASTER_MAX_DAMAGE_RECTS (8)
+#endif
+
+#ifndef RASTER_QUEUE_DRAIN_BATCH
+/*!
+ * \brief Number of queued updates applied at once when draining the queue
+ *
+ * \details Updates are copied on the stack in batches of this size before
+ *     being applied, so the producer can keep pushing while the render runs.
+ */
+#define RASTER_QUEUE_DRAIN_BATCH (16)
+#endif
+
+#ifndef RASTER_THREADS
+/*!
+ * \brief Number of threads used by the tile-binned renderer
+ *
+ * \details raster_api_render_parallel() needs pthreads when this is
+ *     greater than 1. The calling thread counts as one of them. Keep it at
+ *     0 on bare-metal targets, where the tiles are drawn in turn.
+ */
+#define RASTER_THREADS (0)
+#endif
+
+#if RASTER_THREADS > 1
+#include <pthread.h>
+#endif
+
+/*!
+ * \brief Maximum number of decimals of float labels
+ *
+ * \details Higher precisions are clamped to this value.
+ */
+#define RASTER_MAX_FLOAT_PRECISION (9)
+
+#ifndef RASTER_LABEL_CACHE_SIZE
+/*!
+ * \brief Size of the buffer holding the last rendered text of a label
+ *
+ * \details Used to detect visible changes when setting label data, to keep
+ *     the text layout between renders and to redraw only changed glyphs.
+ *     Labels whose formatted text does not fit are always considered changed
+ *     and fully redrawn.
+ */
+#define RASTER_LABEL_CACHE_SIZE (16)
+#endif
+
 /**
  * \brief Represents a rectangle area
  */
@@ -80,6 +135,73 @@ union RasterLabelFormat {
     struct RasterStringFormat string_fmt; /*!< String formatting options */
 };
 
+/*!
+ * \brief New label data for the box with the given id
+ */
+struct RasterUpdate {
+    uint16_t id;                /*!< Identifier of the box to update */
+    union RasterLabelData data; /*!< New content of the label */
+};
+
+/*!
+ * \brief Single-producer/single-consumer queue of label updates
+ *
+ * \details Lock-free ring buffer over caller-provided storage. One thread
+ *     pushes updates, the render thread drains them at the start of every
+ *     frame. The indices run freely and are masked by the capacity, which
+ *     must be a power of two. They are only accessed atomically through the
+ *     queue functions, so that the header stays usable from C++. The queue
+ *     functions use the \c __atomic builtins of GCC and Clang instead of C11
+ *     \c <stdatomic.h>, so the library needs one of these compilers.
+ */
+struct RasterUpdateQueue {
+    struct RasterUpdate *updates; /*!< Storage of the ring buffer */
+    uint32_t mask;                /*!< Capacity of the storage minus one */
+    uint32_t head;                /*!< Next slot to write, owned by the producer */
+    uint32_t tail;                /*!< Next slot to read, owned by the consumer */
+};
+
+/*!
+ * \brief Uniform grid of screen cells listing the boxes touching them
+ *
+ * \details Stored in caller-provided memory. The boxes of a cell are the
+ *     entries from \c cells[c] to \c cells[c + 1], in interface order.
+ *     The grid spans from the origin to the bottom-right corner of the
+ *     furthest box.
+ */
+struct RasterGrid {
+    uint16_t *cells;         /*!< Offset of the first entry of every cell, plus the total */
+    uint16_t cell_capacity;  /*!< Number of offsets the cells storage can hold */
+    uint16_t *entries;       /*!< Positions of the boxes inside the interface, grouped by cell */
+    uint16_t entry_capacity; /*!< Number of positions the entries storage can hold */
+    uint8_t cell_shift;      /*!< Cells are 2^cell_shift pixels wide and tall */
+    uint16_t cols;           /*!< Number of cells on the x axis */
+    uint16_t rows;           /*!< Number of cells on the y axis */
+    bool valid;              /*!< Flag to indicate if the grid matches the interface */
+};
+
+/*!
+ * \brief Render threads kept running between the frames of the tile renderer
+ *
+ * \details Started once by raster_api_workers_init() and parked on a
+ *     condition variable until a frame hands them its tiles, so that no
+ *     thread is created per frame. With \c RASTER_THREADS of 0 or 1 no
+ *     thread is started and only the count, always 0, is kept.
+ */
+struct RasterWorkers {
+    uint16_t count; /*!< Number of running worker threads */
+#if RASTER_THREADS > 1
+    pthread_t threads[RASTER_THREADS - 1]; /*!< Worker threads, the calling thread draws tiles too */
+    pthread_mutex_t lock;                  /*!< Lock of the fields below */
+    pthread_cond_t start;                  /*!< Signaled when a frame is handed out or the workers stop */
+    pthread_cond_t done;                   /*!< Signaled when the last worker finishes a frame */
+    struct RasterTileJob *job;             /*!< Tiles of the current frame */
+    uint32_t frame;                        /*!< Number of frames handed out */
+    uint16_t busy;                         /*!< Number of workers still drawing the current frame */
+    bool stop;                             /*!< Flag asking the workers to exit */
+#endif
+};
+
 /*!
  * \brief Function used to draw a rectangle on screen
  * 
@@ -100,6 +222,23 @@ typedef void (*raster_draw_rectangle_callback)(uint16_t x, uint16_t y, uint16_t
  */
 typedef void (*raster_clear_screen_callback)(void);
 
+/*!
+ * \brief State of the last render of a label
+ *
+ * \details Used to detect visible changes, to reuse the text layout and to
+ *     redraw only the glyphs that changed.
+ */
+struct RasterLabelCache {
+    char text[RASTER_LABEL_CACHE_SIZE];                     /*!< Formatted text of the last render */
+    bool valid;                                             /*!< Flag to indicate if the cache holds the last render */
+    struct FontLayout layout;                               /*!< Layout of the text */
+    struct FontLayoutGlyph glyphs[RASTER_LABEL_CACHE_SIZE]; /*!< Glyph storage of the layout */
+    struct RasterCoords pos;                                /*!< Absolute position of the text */
+    enum FontAlign align;                                   /*!< Alignment of the text */
+    struct Color color;                                     /*!< Color of the text */
+    struct Color background;                                /*!< Background color of the box */
+};
+
 /*!
  * \brief Defines a label to be drawn on screen
  */
@@ -112,6 +251,7 @@ struct RasterLabel {
     uint16_t size;                  /*!< Size of the text */
     enum FontAlign align;           /*!< Alignement of the text relative to coords */
     struct Color color;             /*!< Color of the text */
+    struct RasterLabelCache cache;  /*!< State of the last render */
 };
 
 /*!
@@ -132,9 +272,26 @@ struct RasterHandler {
     struct RasterBox *interface; /*!< Pointer to an array of RasterBox structures */
     uint16_t size;               /*!< Number of boxes in the interface array */
 
-    font_draw_line_callback draw_line;             /*!< Callback to draw a horizontal line */
-    raster_draw_rectangle_callback draw_rectangle; /*!< Callback to draw a filled rectangle */
-    raster_clear_screen_callback clear_screen;     /*!< Callback to clear the screen */
+    font_draw_line_callback draw_line;                /*!< Callback to draw a horizontal line */
+    raster_draw_rectangle_callback draw_rectangle;    /*!< Callback to draw a filled rectangle */
+    raster_clear_screen_callback clear_screen;        /*!< Callback to clear the screen */
+    struct FontSpanBuffer *span_buffer;               /*!< Optional buffer to batch text spans (can be NULL) */
+    font_draw_rectangle_callback draw_text_rectangle; /*!< Optional callback to draw text as rectangles (can be NULL) */
+    bool opaque_text;                                 /*!< Flag to pre-blend text over opaque box backgrounds */
+    struct FontGlyphCache *glyph_cache;               /*!< Optional cache of decoded glyphs (can be NULL) */
+
+    uint16_t *index;         /*!< Optional storage of box positions sorted by id (can be NULL) */
+    uint16_t index_capacity; /*!< Number of entries the index storage can hold */
+    bool index_valid;        /*!< Flag to indicate if the index matches the interface */
+
+    struct RasterGrid *grid; /*!< Optional spatial index of the boxes (can be NULL) */
+
+    struct RasterUpdateQueue *queue; /*!< Optional queue drained at the start of every render (can be NULL) */
+
+    struct RasterWorkers *workers; /*!< Optional threads drawing tiles with the calling one (can be NULL) */
+
+    struct RasterRect damage[RASTER_MAX_DAMAGE_RECTS]; /*!< Areas redrawn by the last render */
+    uint16_t damage_count;                             /*!< Number of valid rectangles in damage */
 };
 
 #endif // RASTER_H
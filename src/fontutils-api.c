@@ -14,6 +14,339 @@
 
 #include "fontutils-api.h"
 #include "eagletrt.h"
+#include <stddef.h>
+#include <string.h>
+
+#ifndef FONT_MAX_OPEN_RECTS
+/*!
+ * \brief Maximum number of rectangles kept open while merging glyph rows
+ *
+ * \details Rows with more runs draw their oldest rectangles early, which
+ *     only costs merging.
+ */
+#define FONT_MAX_OPEN_RECTS (16)
+#endif
+
+#if RASTER_FIXED_POINT
+/*!
+ * \brief Scaling factor or scaled length, in Q16.16 fixed point
+ */
+typedef uint32_t font_scale_t;
+
+/*!
+ * \brief Number of fractional bits of font_scale_t
+ */
+#define FONT_SCALE_SHIFT (16)
+#else
+/*!
+ * \brief Scaling factor or scaled length, in floating point
+ */
+typedef float font_scale_t;
+#endif
+
+/*!
+ * \brief Scales an unscaled length
+ *
+ * \param[in] value Length in glyph pixels
+ * \param[in] multiplier Scaling factor
+ *
+ * \return font_scale_t The scaled length, not truncated
+ */
+EAGLETRT_STATIC_INLINE font_scale_t prv_scale(uint16_t value, font_scale_t multiplier) {
+    return value * multiplier;
+}
+
+/*!
+ * \brief Truncates a scaled length to whole pixels
+ *
+ * \param[in] value Scaled length
+ *
+ * \return uint16_t Integer part of the length
+ */
+EAGLETRT_STATIC_INLINE uint16_t prv_scale_to_int(font_scale_t value) {
+#if RASTER_FIXED_POINT
+    return (uint16_t)(value >> FONT_SCALE_SHIFT);
+#else
+    return (uint16_t)value;
+#endif
+}
+
+/*!
+ * \brief Rectangle that can still grow with runs of the next source row
+ *
+ * \details Not clipped yet, so that runs are merged the same way whatever
+ *     the clip area.
+ */
+struct FontOpenRect {
+    int32_t x;     /*!< X position of the rectangle */
+    int32_t y;     /*!< Y position of the rectangle */
+    uint16_t w;    /*!< Width of the rectangle */
+    uint16_t h;    /*!< Height of the rectangle */
+    uint32_t argb; /*!< Color of the rectangle */
+    int16_t row;   /*!< Last source row merged into the rectangle */
+};
+
+#ifndef FONT_LAYOUT_STACK_GLYPHS
+/*!
+ * \brief Number of glyphs laid out on the stack when drawing aligned text
+ *
+ * \details Longer aligned strings are measured and drawn in two passes.
+ */
+#define FONT_LAYOUT_STACK_GLYPHS (32)
+#endif
+
+/*!
+ * \brief Number of fonts generated in fonts.h, pack fonts are numbered after them
+ */
+#define FONT_BUILTIN_COUNT ((uint32_t)(sizeof(fonts) / sizeof(fonts[0])))
+
+/*!
+ * \brief Size of the header of a binary font pack
+ */
+#define FONT_PACK_HEADER_SIZE (16)
+
+/*!
+ * \brief Size of a font record of a binary font pack
+ */
+#define FONT_PACK_FONT_SIZE (32)
+
+/*!
+ * \brief Size of a glyph level record of a binary font pack
+ */
+#define FONT_PACK_LEVEL_SIZE (16)
+
+/*!
+ * \brief Size of a glyph record of a binary font pack, same as struct Glyph
+ */
+#define FONT_PACK_GLYPH_SIZE (16)
+
+/*!
+ * \brief Font pack whose fonts are registered, with no fonts if none
+ */
+static struct FontPack prv_pack;
+
+/*!
+ * \brief Gets a generated or registered font
+ *
+ * \param[in] font Font name enumeration
+ *
+ * \return const struct Font* The font, NULL if no font has this name
+ */
+EAGLETRT_STATIC_INLINE const struct Font *prv_font(enum FontName font) {
+    if ((uint32_t)font < FONT_BUILTIN_COUNT)
+        return &fonts[font];
+    // Without a registered pack its font count is zero and no font is read
+    if ((uint32_t)font - FONT_BUILTIN_COUNT < prv_pack.font_count)
+        return &prv_pack.fonts[(uint32_t)font - FONT_BUILTIN_COUNT];
+    return NULL;
+}
+
+/*!
+ * \brief Runs of a glyph being stored in a glyph cache
+ */
+struct FontRecord {
+    struct FontGlyphRun *runs; /*!< Storage of the runs */
+    uint32_t capacity;         /*!< Number of runs the storage can hold */
+    uint32_t count;            /*!< Number of runs of the glyph, also past the capacity */
+};
+
+/*!
+ * \brief Destination of the pixels produced by the text renderer
+ *
+ * \details When drawing rectangles, identical runs of consecutive source rows
+ *     are merged into taller rectangles. When recording, runs or merged
+ *     rectangles are stored unclipped instead of drawn.
+ */
+struct FontOutput {
+    struct FontTarget target;                      /*!< Callbacks receiving the pixels */
+    struct FontClip clip;                          /*!< Area the pixels are restricted to */
+    struct FontOpenRect open[FONT_MAX_OPEN_RECTS]; /*!< Rectangles still being merged */
+    uint8_t open_count;                            /*!< Number of open rectangles */
+    bool merge;                                    /*!< Flag to merge runs into rectangles */
+    struct FontRecord *record;                     /*!< Storage of the runs when recording (can be NULL) */
+};
+
+/*!
+ * \brief Prepares an output for the given target
+ *
+ * \details Without a clip area in the target, pixels are still restricted to
+ *     the coordinates representable by the callbacks, so that text moved to
+ *     negative positions by the alignment is cut instead of wrapping around.
+ *
+ * \param[out] out The output to prepare
+ * \param[in] target Callbacks receiving the pixels
+ */
+EAGLETRT_STATIC_INLINE void prv_output_init(struct FontOutput *out, const struct FontTarget *target) {
+    out->target = *target;
+    out->clip = target->clip != NULL ? *target->clip : (struct FontClip){ 0, 0, UINT16_MAX, UINT16_MAX };
+    out->open_count = 0;
+    out->merge = target->span_buffer == NULL && target->rectangle_callback != NULL;
+    out->record = NULL;
+}
+
+/*!
+ * \brief Stores a run of a glyph being recorded
+ *
+ * \param[in,out] record Storage of the runs
+ * \param[in] x X offset of the run
+ * \param[in] y Y offset of the run
+ * \param[in] w Width of the run
+ * \param[in] h Height of the run
+ * \param[in] argb Color of the run, coverage in the alpha channel
+ * \param[in] row Last source row of the run
+ */
+EAGLETRT_STATIC_INLINE void prv_record_run(struct FontRecord *record, int32_t x, int32_t y, int32_t w, int32_t h, uint32_t argb, int16_t row) {
+    if (record->count < record->capacity)
+        record->runs[record->count] = (struct FontGlyphRun){ (uint16_t)x, (uint16_t)y, (uint16_t)w, (uint16_t)h, (uint16_t)row, (uint8_t)(argb >> 24) };
+    record->count++;
+}
+
+/*!
+ * \brief Emits a horizontal line of pixels to the output
+ *
+ * \param[in] out Destination of the line
+ * \param[in] x X position to start drawing
+ * \param[in] y Y position to draw
+ * \param[in] length Length of the line
+ * \param[in] color Color of the line, coverage in the alpha channel
+ */
+EAGLETRT_STATIC_INLINE void prv_emit_line(const struct FontOutput *out, uint16_t x, uint16_t y, uint16_t length, struct Color color) {
+    struct FontSpanBuffer *buffer = out->target.span_buffer;
+    if (buffer == NULL) {
+        out->target.line_callback(x, y, length, color);
+        return;
+    }
+    if (buffer->count == buffer->capacity)
+        font_api_flush_spans(buffer);
+    buffer->spans[buffer->count++] = (struct FontSpan){ x, y, length, color };
+}
+
+/*!
+ * \brief Restricts a run of pixels to a clip area
+ *
+ * \param[in] clip The clip area
+ * \param[in,out] x X position of the run
+ * \param[in,out] y Y position of the run
+ * \param[in,out] w Width of the run
+ * \param[in,out] h Height of the run
+ *
+ * \return bool
+ *     - true if part of the run is left
+ *     - false if the run is completely outside
+ */
+EAGLETRT_STATIC_INLINE bool prv_clip_run(const struct FontClip *clip, int32_t *x, int32_t *y, int32_t *w, int32_t *h) {
+    int32_t x0 = *x > clip->x ? *x : clip->x;
+    int32_t y0 = *y > clip->y ? *y : clip->y;
+    int32_t x1 = *x + *w < (int32_t)clip->x + clip->w ? *x + *w : (int32_t)clip->x + clip->w;
+    int32_t y1 = *y + *h < (int32_t)clip->y + clip->h ? *y + *h : (int32_t)clip->y + clip->h;
+    if (x1 <= x0 || y1 <= y0)
+        return false;
+    *x = x0;
+    *y = y0;
+    *w = x1 - x0;
+    *h = y1 - y0;
+    return true;
+}
+
+/*!
+ * \brief Draws or records an open rectangle
+ *
+ * \param[in,out] out Destination of the rectangle
+ * \param[in] r Rectangle to draw
+ */
+static void prv_close_open_rect(struct FontOutput *out, const struct FontOpenRect *r) {
+    if (out->record != NULL) {
+        prv_record_run(out->record, r->x, r->y, r->w, r->h, r->argb, r->row);
+        return;
+    }
+    int32_t x = r->x, y = r->y, w = r->w, h = r->h;
+    if (prv_clip_run(&out->clip, &x, &y, &w, &h))
+        out->target.rectangle_callback((uint16_t)x, (uint16_t)y, (uint16_t)w, (uint16_t)h, (struct Color){ .argb = r->argb });
+}
+
+/*!
+ * \brief Draws the open rectangles that can no longer be extended
+ *
+ * \param[in,out] out Destination of the rectangles
+ * \param[in] min_row Rectangles whose last row is before this are drawn
+ */
+static void prv_flush_open_rects(struct FontOutput *out, int16_t min_row) {
+    uint8_t kept = 0;
+    for (uint8_t i = 0; i < out->open_count; i++) {
+        struct FontOpenRect *r = &out->open[i];
+        if (r->row >= min_row)
+            out->open[kept++] = *r;
+        else
+            prv_close_open_rect(out, r);
+    }
+    out->open_count = kept;
+}
+
+/*!
+ * \brief Emits a scaled run of pixels to the output
+ *
+ * \details With a rectangle callback the run is merged with the identical
+ *     run of the previous source row, if any, otherwise it is drawn line by
+ *     line. Runs are clipped to the clip area of the output, after merging
+ *     so that a pixel is blended as many times as without clip.
+ *
+ * \param[in,out] out Destination of the run
+ * \param[in] x X position of the run
+ * \param[in] y Y position of the run
+ * \param[in] w Width of the run
+ * \param[in] h Height of the run
+ * \param[in] argb Color of the run, coverage in the alpha channel
+ * \param[in] row Source row of the run inside the glyph
+ */
+EAGLETRT_STATIC_INLINE void prv_emit_run(struct FontOutput *out, int32_t x, int32_t y, int32_t w, int32_t h, uint32_t argb, int16_t row) {
+    if (!out->merge) {
+        if (out->record != NULL) {
+            prv_record_run(out->record, x, y, w, h, argb, row);
+            return;
+        }
+        if (!prv_clip_run(&out->clip, &x, &y, &w, &h))
+            return;
+        for (int j = 0; j < h; ++j) {
+            prv_emit_line(out, x, y + j, w, (struct Color){ .argb = argb });
+        }
+        return;
+    }
+
+    prv_flush_open_rects(out, row - 1);
+    for (uint8_t i = 0; i < out->open_count; i++) {
+        struct FontOpenRect *r = &out->open[i];
+        if (r->row == row - 1 && r->x == x && r->w == w && r->argb == argb) {
+            r->h = (uint16_t)(y + h - r->y);
+            r->row = row;
+            return;
+        }
+    }
+    if (out->open_count == FONT_MAX_OPEN_RECTS)
+        prv_flush_open_rects(out, row);
+    if (out->open_count == FONT_MAX_OPEN_RECTS) {
+        // Every open rectangle is on this row: the oldest one stops growing
+        prv_close_open_rect(out, &out->open[0]);
+        memmove(&out->open[0], &out->open[1], (FONT_MAX_OPEN_RECTS - 1) * sizeof(out->open[0]));
+        out->open_count--;
+    }
+    out->open[out->open_count++] = (struct FontOpenRect){ x, y, (uint16_t)w, (uint16_t)h, argb, row };
+}
+
+/*!
+ * \brief Computes the color of a run of text pixels
+ *
+ * \param[in] out Destination of the run
+ * \param[in] color Base color of the text
+ * \param[in] value Coverage of the run
+ *
+ * \return uint32_t The palette color of the coverage, if any, otherwise the
+ *     text color with the coverage in the alpha channel
+ */
+EAGLETRT_STATIC_INLINE uint32_t prv_run_color(const struct FontOutput *out, struct Color color, uint8_t value) {
+    if (out->target.palette != NULL)
+        return out->target.palette[value >> 4];
+    return (color.argb & 0x00ffffff) | ((uint32_t)value << 24);
+}
 
 /*!
  * \brief Draw a run-length encoded series of pixel_size
@@ -21,6 +354,7 @@
  * \details This function draws a series of pixels encoded with run-length
  *     encoding (RLE). It calculates the position and size of the pixels to be
  *     drawn based on the provided parameters, including scaling multiplier.
+ *     Series crossing the right edge of the glyph are split per row.
  * 
  * \param[in] count Number of pixels in the series
  * \param[in] value Alpha value of the pixels in the series
@@ -31,9 +365,9 @@
  * \param[in,out] current_x Current X position in the glyph
  * \param[in,out] current_y Current Y position in the glyph
  * \param[in] color Base color of the glyph
- * \param[in] line_callback Callback to draw a horizontal line of pixels
+ * \param[in,out] out Destination of the drawn pixels
  */
-EAGLETRT_STATIC_INLINE void prv_draw_rle_series(uint8_t count, uint8_t value, uint16_t x, uint16_t y, float multiplier, int16_t glyph_width, int16_t *current_x, int16_t *current_y, struct Color color, font_draw_line_callback line_callback) {
+EAGLETRT_STATIC_INLINE void prv_draw_rle_series(uint8_t count, uint8_t value, int32_t x, int32_t y, font_scale_t multiplier, int16_t glyph_width, int16_t *current_x, int16_t *current_y, struct Color color, struct FontOutput *out) {
     if (value < 30) {
         *current_x += count;
         *current_y += *current_x / glyph_width;
@@ -41,28 +375,403 @@ EAGLETRT_STATIC_INLINE void prv_draw_rle_series(uint8_t count, uint8_t value, ui
         return;
     }
 
-    uint32_t blended_color = (color.argb & 0x00ffffff) | ((uint32_t)value << 24);
+    uint32_t blended_color = prv_run_color(out, color, value);
+
+    while (count > 0) {
+        uint8_t row_count = count;
+        if (*current_x + row_count > glyph_width)
+            row_count = glyph_width - *current_x;
+
+        int32_t start_x = x + prv_scale_to_int(prv_scale(*current_x, multiplier));
+        int32_t start_y = y + prv_scale_to_int(prv_scale(*current_y, multiplier));
+        int32_t end_x = x + prv_scale_to_int(prv_scale(*current_x + row_count, multiplier));
+        int32_t end_y = y + prv_scale_to_int(prv_scale(*current_y + 1, multiplier));
+        int32_t draw_width = end_x - start_x;
+        int32_t draw_height = end_y - start_y;
+
+        if (draw_width < 1)
+            draw_width = 1;
+        if (draw_height < 1)
+            draw_height = 1;
+
+        // Fill any potential gaps when scaling by ensuring consecutive rows are drawn
+        prv_emit_run(out, start_x, start_y, draw_width, draw_height, blended_color, *current_y);
+
+        count -= row_count;
+        *current_x += row_count;
+        if (*current_x == glyph_width) {
+            *current_x = 0;
+            (*current_y)++;
+        }
+    }
+}
+
+/*!
+ * \brief Decodes the run-length encoded data of a glyph
+ *
+ * \param[in] glyph Pointer to the Glyph structure to decode
+ * \param[in] level Glyph level holding the glyph data
+ * \param[in] x X position to render the glyph
+ * \param[in] y Y position to render the glyph
+ * \param[in] multiplier Scaling multiplier for the glyph size
+ * \param[in] color Base color of the glyph
+ * \param[in] last_row Source row where decoding stops
+ * \param[in,out] out Destination of the drawn pixels
+ */
+EAGLETRT_STATIC_INLINE void prv_decode_glyph(const struct Glyph *glyph, const struct FontLevel *level, int32_t x, int32_t y, font_scale_t multiplier, struct Color color, int16_t last_row, struct FontOutput *out) {
+    const uint8_t *data = &level->sdf_data[glyph->offset];
+    uint16_t remaining_size = glyph->size;
+    int16_t current_x = 0;
+    int16_t current_y = 0;
+
+    while (remaining_size > 0 && current_y < last_row) {
+        uint8_t value_raw = *data++;
+        uint8_t value1 = (value_raw & 0xF0);
+        uint8_t value2 = (value_raw << 4);
+        uint8_t count1 = *data++;
+        uint8_t count2 = *data++;
+        remaining_size -= 3;
 
-    int16_t start_x = x + (*current_x * multiplier);
-    int16_t start_y = y + (*current_y * multiplier);
-    int16_t end_x = x + ((*current_x + count) * multiplier);
-    int16_t end_y = y + ((*current_y + 1) * multiplier);
-    int16_t draw_width = (int16_t)(end_x - start_x + 0.5f);
-    int16_t draw_height = (int16_t)(end_y - start_y + 0.5f);
+        prv_draw_rle_series(count1, value1, x, y, multiplier, glyph->width, &current_x, &current_y, color, out);
+        prv_draw_rle_series(count2, value2, x, y, multiplier, glyph->width, &current_x, &current_y, color, out);
+    }
+}
 
+/*!
+ * \brief Draws a series of pixels of a single row of a glyph
+ *
+ * \param[in] start First column of the series
+ * \param[in] end Column after the series
+ * \param[in] value Alpha value of the pixels in the series
+ * \param[in] x X position of the glyph
+ * \param[in] y Y position of the row
+ * \param[in] h Height of the row
+ * \param[in] row Row of the series inside the glyph
+ * \param[in] multiplier Scaling multiplier
+ * \param[in] color Base color of the glyph
+ * \param[in,out] out Destination of the drawn pixels
+ */
+EAGLETRT_STATIC_INLINE void prv_draw_row_series(uint16_t start, uint16_t end, uint8_t value, int32_t x, int32_t y, int32_t h, int16_t row, font_scale_t multiplier, struct Color color, struct FontOutput *out) {
+    if (value < 30 || start == end)
+        return;
+    int32_t start_x = x + prv_scale_to_int(prv_scale(start, multiplier));
+    int32_t draw_width = x + prv_scale_to_int(prv_scale(end, multiplier)) - start_x;
     if (draw_width < 1)
         draw_width = 1;
-    if (draw_height < 1)
-        draw_height = 1;
+    prv_emit_run(out, start_x, y, draw_width, h, prv_run_color(out, color, value), row);
+}
+
+/*!
+ * \brief Decodes the row-indexed run-length encoded data of a glyph
+ *
+ * \details Rows above the clip area are skipped through the row table, and
+ *     series never cross rows, so no row needs the previous ones.
+ *
+ * \param[in] glyph Pointer to the Glyph structure to decode
+ * \param[in] level Glyph level holding the glyph data
+ * \param[in] x X position to render the glyph
+ * \param[in] y Y position to render the glyph
+ * \param[in] multiplier Scaling multiplier for the glyph size
+ * \param[in] color Base color of the glyph
+ * \param[in] last_row Source row where decoding stops
+ * \param[in,out] out Destination of the drawn pixels
+ */
+EAGLETRT_STATIC_INLINE void prv_decode_glyph_rows(const struct Glyph *glyph, const struct FontLevel *level, int32_t x, int32_t y, font_scale_t multiplier, struct Color color, int16_t last_row, struct FontOutput *out) {
+    const uint8_t *data = &level->sdf_data[glyph->offset];
+    int16_t height = glyph->height;
+
+    // Rows are at least one pixel tall, even when scaled down
+    int16_t row = 0;
+    int32_t row_y = y;
+    int32_t next_y = y + prv_scale_to_int(prv_scale(1, multiplier));
+    while (row < last_row && (next_y > row_y ? next_y : row_y + 1) <= out->clip.y) {
+        row++;
+        row_y = next_y;
+        next_y = y + prv_scale_to_int(prv_scale(row + 1, multiplier));
+    }
+
+    for (; row < last_row; row++) {
+        const uint8_t *series = data + (data[2 * row] | (data[2 * row + 1] << 8));
+        const uint8_t *end = data + (row + 1 < height ? data[2 * row + 2] | (data[2 * row + 3] << 8) : glyph->size);
+        int32_t h = next_y > row_y ? next_y - row_y : 1;
+        uint16_t current_x = 0;
+
+        while (series < end) {
+            uint8_t value_raw = series[0];
+            uint16_t end1 = current_x + series[1];
+            uint16_t end2 = end1 + series[2];
+            series += 3;
+
+            prv_draw_row_series(current_x, end1, value_raw & 0xF0, x, row_y, h, row, multiplier, color, out);
+            prv_draw_row_series(end1, end2, (uint8_t)(value_raw << 4), x, row_y, h, row, multiplier, color, out);
+            current_x = end2;
+        }
+
+        row_y = next_y;
+        next_y = y + prv_scale_to_int(prv_scale(row + 2, multiplier));
+    }
+}
+
+/*!
+ * \brief Maps an output pixel to the distance field, at its center
+ *
+ * \param[in] pixel Position of the output pixel inside the glyph
+ * \param[in] step Distance between two output pixels in the field, Q16.16
+ * \param[in] limit Size of the field on the same axis
+ *
+ * \return uint32_t Position in the field, Q16.16, clamped to its samples
+ */
+EAGLETRT_STATIC_INLINE uint32_t prv_sdf_coord(int32_t pixel, uint32_t step, uint16_t limit) {
+    int64_t position = (int64_t)(((uint64_t)(2 * pixel + 1) * step) >> 1) - (1 << 15);
+    if (position < 0)
+        return 0;
+    if (position > ((int64_t)(limit - 1) << 16))
+        return (uint32_t)(limit - 1) << 16;
+    return (uint32_t)position;
+}
+
+/*!
+ * \brief Maps a distance to a 4 bits coverage with a smoothstep
+ *
+ * \param[in] distance Distance sampled from the field
+ * \param[in] edge0 Distance of zero coverage
+ * \param[in] inverse_range 65536 divided by the distance between the edges
+ *
+ * \return uint8_t The coverage, 0 for pixels dropped like in encoded glyphs
+ */
+EAGLETRT_STATIC_INLINE uint8_t prv_sdf_coverage(int32_t distance, int32_t edge0, uint32_t inverse_range) {
+    if (distance <= edge0)
+        return 0;
+    uint32_t t = ((uint32_t)(distance - edge0) * inverse_range) >> 8;
+    if (t > 256)
+        t = 256;
+    uint32_t step = (t * t * (768 - 2 * t)) >> 16;
+    uint8_t value = (uint8_t)((step > 255 ? 255 : step) & 0xF0);
+    return value < 30 ? 0 : value;
+}
+
+/*!
+ * \brief Renders a glyph stored as a signed distance field
+ *
+ * \details Every pixel samples the field bilinearly at its center and maps
+ *     the distance to a coverage between the edges of the font. When scaling
+ *     up, the edges get closer so that the outline stays as sharp as at the
+ *     generated size. Pixels of equal coverage are emitted as a single run,
+ *     and only pixels inside the clip area are sampled.
+ *
+ * \param[in] glyph Pointer to the Glyph structure to be rendered
+ * \param[in] font Font name enumeration
+ * \param[in] level Glyph level holding the glyph data
+ * \param[in] size Size the glyph is drawn at
+ * \param[in] x X position to render the glyph
+ * \param[in] y Y position to render the glyph
+ * \param[in] multiplier Scaling multiplier for the glyph size
+ * \param[in] color Base color of the glyph
+ * \param[in,out] out Destination of the drawn pixels
+ */
+static void prv_sample_sdf_glyph(const struct Glyph *glyph, enum FontName font, const struct FontLevel *level, uint16_t size, int32_t x, int32_t y, font_scale_t multiplier, struct Color color, struct FontOutput *out) {
+    uint16_t width = glyph->width;
+    uint16_t height = glyph->height;
+    if (width == 0 || height == 0 || size == 0)
+        return;
+    const uint8_t *data = &level->sdf_data[glyph->offset];
+
+    const struct FontClip *clip = &out->clip;
+    int32_t w = prv_scale_to_int(prv_scale(width, multiplier));
+    int32_t h = prv_scale_to_int(prv_scale(height, multiplier));
+    int32_t col0 = clip->x > x ? clip->x - x : 0;
+    int32_t col1 = (int32_t)clip->x + clip->w - x < w ? (int32_t)clip->x + clip->w - x : w;
+    int32_t row0 = clip->y > y ? clip->y - y : 0;
+    int32_t row1 = (int32_t)clip->y + clip->h - y < h ? (int32_t)clip->y + clip->h - y : h;
+
+    int32_t edge1 = prv_font(font)->edges[1];
+    int32_t edge0 = prv_font(font)->edges[0];
+    if (size > level->height)
+        edge0 = edge1 - (edge1 - edge0) * level->height / size;
+    if (edge0 >= edge1)
+        edge0 = edge1 - 1;
+    uint32_t inverse_range = 65536u / (uint32_t)(edge1 - edge0);
+    uint32_t step = ((uint32_t)level->height << 16) / size;
 
-    // Fill any potential gaps when scaling by ensuring consecutive rows are drawn
-    for (int j = 0; j < draw_height; ++j) {
-        line_callback(start_x, start_y + j, draw_width, (struct Color){ .argb = blended_color });
+    for (int32_t oy = row0; oy < row1; oy++) {
+        uint32_t sy = prv_sdf_coord(oy, step, height);
+        const uint8_t *top = &data[(sy >> 16) * width];
+        const uint8_t *bottom = (sy >> 16) + 1 < height ? top + width : top;
+        uint32_t fy = (sy >> 8) & 0xff;
+
+        int32_t run_start = col0;
+        uint8_t run_value = 0;
+        for (int32_t ox = col0; ox < col1; ox++) {
+            uint32_t sx = prv_sdf_coord(ox, step, width);
+            uint32_t ix = sx >> 16;
+            uint32_t ix1 = ix + 1 < width ? ix + 1 : ix;
+            uint32_t fx = (sx >> 8) & 0xff;
+            uint32_t upper = top[ix] * (256 - fx) + top[ix1] * fx;
+            uint32_t lower = bottom[ix] * (256 - fx) + bottom[ix1] * fx;
+            uint8_t value = prv_sdf_coverage((int32_t)((upper * (256 - fy) + lower * fy) >> 16), edge0, inverse_range);
+            if (value == run_value)
+                continue;
+            if (run_value != 0)
+                prv_emit_run(out, x + run_start, y + oy, ox - run_start, 1, prv_run_color(out, color, run_value), (int16_t)oy);
+            run_start = ox;
+            run_value = value;
+        }
+        if (run_value != 0)
+            prv_emit_run(out, x + run_start, y + oy, col1 - run_start, 1, prv_run_color(out, color, run_value), (int16_t)oy);
     }
+}
+
+/*!
+ * \brief Draws the data of a glyph in the format of its font
+ *
+ * \param[in] glyph Pointer to the Glyph structure to be rendered
+ * \param[in] font Font name enumeration
+ * \param[in] level Glyph level holding the glyph data
+ * \param[in] size Size the glyph is drawn at
+ * \param[in] x X position to render the glyph
+ * \param[in] y Y position to render the glyph
+ * \param[in] multiplier Scaling multiplier for the glyph size
+ * \param[in] color Base color of the glyph
+ * \param[in] last_row Source row where decoding stops
+ * \param[in,out] out Destination of the drawn pixels
+ */
+EAGLETRT_STATIC_INLINE void prv_draw_glyph_data(const struct Glyph *glyph, enum FontName font, const struct FontLevel *level, uint16_t size, int32_t x, int32_t y, font_scale_t multiplier, struct Color color, int16_t last_row, struct FontOutput *out) {
+    uint8_t format = prv_font(font)->format;
+    if (format == FONT_FORMAT_SDF)
+        prv_sample_sdf_glyph(glyph, font, level, size, x, y, multiplier, color, out);
+    else if (format == FONT_FORMAT_RLE_ROWS)
+        prv_decode_glyph_rows(glyph, level, x, y, multiplier, color, last_row, out);
+    else
+        prv_decode_glyph(glyph, level, x, y, multiplier, color, last_row, out);
+}
 
-    *current_x += count;
-    *current_y += *current_x / glyph_width;
-    *current_x %= glyph_width;
+/*!
+ * \brief Draws a whole glyph into a record, relative to its position
+ *
+ * \param[in] glyph Pointer to the Glyph structure to record
+ * \param[in] font Font name enumeration
+ * \param[in] level Glyph level holding the glyph data
+ * \param[in] size Size the glyph is drawn at
+ * \param[in] multiplier Scaling multiplier for the glyph size
+ * \param[in] merged Whether to store runs merged into rectangles
+ * \param[in,out] record Storage of the runs
+ */
+static void prv_record_glyph(const struct Glyph *glyph, enum FontName font, const struct FontLevel *level, uint16_t size, font_scale_t multiplier, bool merged, struct FontRecord *record) {
+    // Neither runs nor merged rectangles depend on the clip, so they can be replayed anywhere
+    struct FontOutput out;
+    prv_output_init(&out, &(struct FontTarget){ .line_callback = NULL });
+    out.merge = merged;
+    out.record = record;
+    prv_draw_glyph_data(glyph, font, level, size, 0, 0, multiplier, (struct Color){ .argb = 0 }, glyph->height, &out);
+    prv_flush_open_rects(&out, INT16_MAX);
+}
+
+/*!
+ * \brief Removes the least recently drawn glyph from a glyph cache
+ *
+ * \details The runs of the following glyphs are moved down, so that the free
+ *     storage is always at the end.
+ *
+ * \param[in,out] cache Pointer to the glyph cache
+ */
+static void prv_cache_evict(struct FontGlyphCache *cache) {
+    uint16_t lru = 0;
+    for (uint16_t i = 1; i < cache->entry_count; i++) {
+        if (cache->entries[i].last_used < cache->entries[lru].last_used)
+            lru = i;
+    }
+
+    struct FontGlyphCacheEntry *entry = &cache->entries[lru];
+    uint16_t count = entry->count;
+    uint32_t end = entry->first + count;
+    memmove(&cache->runs[entry->first], &cache->runs[end], (cache->run_count - end) * sizeof(cache->runs[0]));
+    cache->run_count -= count;
+    memmove(entry, entry + 1, (cache->entry_count - lru - 1) * sizeof(cache->entries[0]));
+    cache->entry_count--;
+    for (uint16_t i = lru; i < cache->entry_count; i++)
+        cache->entries[i].first -= count;
+}
+
+/*!
+ * \brief Finds a glyph inside a glyph cache, decoding it on a miss
+ *
+ * \details On a miss the glyph is decoded into the free storage. When it does
+ *     not fit, the least recently drawn glyphs are evicted and it is decoded
+ *     again.
+ *
+ * \param[in,out] cache Pointer to the glyph cache
+ * \param[in] glyph Pointer to the Glyph structure to find
+ * \param[in] font Font name enumeration
+ * \param[in] level Glyph level holding the glyph
+ * \param[in] size Size the glyph is drawn at
+ * \param[in] multiplier Scaling multiplier for the glyph size
+ * \param[in] merged Whether the runs are drawn as merged rectangles
+ *
+ * \return const struct FontGlyphCacheEntry* The cached glyph, NULL if it does
+ *     not fit in the cache
+ */
+static const struct FontGlyphCacheEntry *prv_cache_glyph(struct FontGlyphCache *cache, const struct Glyph *glyph, enum FontName font, const struct FontLevel *level, uint16_t size, font_scale_t multiplier, bool merged) {
+    uint8_t index = (uint8_t)(glyph - level->glyphs);
+    cache->clock++;
+    for (uint16_t i = 0; i < cache->entry_count; i++) {
+        struct FontGlyphCacheEntry *entry = &cache->entries[i];
+        if (entry->glyph == index && entry->size == size && entry->font == font && entry->merged == merged) {
+            entry->last_used = cache->clock;
+            cache->hits++;
+            return entry;
+        }
+    }
+
+    cache->misses++;
+    if (cache->entry_capacity == 0)
+        return NULL;
+    struct FontRecord record = { &cache->runs[cache->run_count], cache->run_capacity - cache->run_count, 0 };
+    prv_record_glyph(glyph, font, level, size, multiplier, merged, &record);
+    if (record.count > cache->run_capacity || record.count > UINT16_MAX)
+        return NULL;
+
+    bool stored = record.count <= record.capacity && cache->entry_count < cache->entry_capacity;
+    while (cache->entry_count == cache->entry_capacity || cache->run_count + record.count > cache->run_capacity)
+        prv_cache_evict(cache);
+    if (!stored) {
+        record = (struct FontRecord){ &cache->runs[cache->run_count], record.count, 0 };
+        prv_record_glyph(glyph, font, level, size, multiplier, merged, &record);
+    }
+
+    struct FontGlyphCacheEntry *entry = &cache->entries[cache->entry_count++];
+    *entry = (struct FontGlyphCacheEntry){ cache->run_count, cache->clock, (uint16_t)record.count, size, font, index, merged };
+    cache->run_count += record.count;
+    return entry;
+}
+
+/*!
+ * \brief Draws the runs of a glyph stored in a glyph cache
+ *
+ * \details Merged rectangles are clipped and drawn directly, other runs go
+ *     through the output like decoded ones.
+ *
+ * \param[in] cache Pointer to the glyph cache
+ * \param[in] entry The cached glyph
+ * \param[in] x X position to render the glyph
+ * \param[in] y Y position to render the glyph
+ * \param[in] color Base color of the glyph
+ * \param[in,out] out Destination of the drawn pixels
+ */
+EAGLETRT_STATIC_INLINE void prv_replay_glyph(const struct FontGlyphCache *cache, const struct FontGlyphCacheEntry *entry, int32_t x, int32_t y, struct Color color, struct FontOutput *out) {
+    const struct FontGlyphRun *run = &cache->runs[entry->first];
+    const struct FontGlyphRun *end = run + entry->count;
+    for (; run < end; run++) {
+        uint32_t argb = prv_run_color(out, color, run->value);
+        if (entry->merged) {
+            int32_t rx = x + run->x, ry = y + run->y, rw = run->w, rh = run->h;
+            if (prv_clip_run(&out->clip, &rx, &ry, &rw, &rh))
+                out->target.rectangle_callback((uint16_t)rx, (uint16_t)ry, (uint16_t)rw, (uint16_t)rh, (struct Color){ .argb = argb });
+        } else if (y + run->y < (int32_t)out->clip.y + out->clip.h) {
+            prv_emit_run(out, x + run->x, y + run->y, run->w, run->h, argb, run->row);
+        } else {
+            break;
+        }
+    }
 }
 
 /*!
@@ -71,73 +780,526 @@ EAGLETRT_STATIC_INLINE void prv_draw_rle_series(uint8_t count, uint8_t value, ui
  * \details This function renders a glyph at the specified position (x, y)
  *     with the given scaling multiplier and color. It processes the glyph's
  *     SDF data using run-length encoding (RLE) to efficiently draw the pixels.
+ *     Glyphs outside the clip area are not decoded at all, and decoding stops
+ *     at the first row below it. With a glyph cache in the target, the runs
+ *     are decoded and scaled once per size.
  * 
  * \param[in] glyph Pointer to the Glyph structure to be rendered
  * \param[in] font Font name enumeration
+ * \param[in] level Glyph level holding the glyph
+ * \param[in] size Size the glyph is drawn at
  * \param[in] x X position to render the glyph
  * \param[in] y Y position to render the glyph
  * \param[in] multiplier Scaling multiplier for the glyph size
  * \param[in] color Base color of the glyph
- * \param[in] line_callback Callback to draw a horizontal line of pixels
+ * \param[in,out] out Destination of the drawn pixels
  */
-EAGLETRT_STATIC_INLINE void prv_render_glyph(const struct Glyph *glyph, enum FontName font, uint16_t x, uint16_t y, float multiplier, struct Color color, font_draw_line_callback line_callback) {
-    const uint8_t *data = &fonts[font].sdf_data[glyph->offset];
-    uint16_t remaining_size = glyph->size;
+EAGLETRT_STATIC_INLINE void prv_render_glyph(const struct Glyph *glyph, enum FontName font, const struct FontLevel *level, uint16_t size, int32_t x, int32_t y, font_scale_t multiplier, struct Color color, struct FontOutput *out) {
     uint16_t glyph_width = glyph->width;
     uint16_t glyph_height = glyph->height;
 
-    int16_t current_x = 0;
-    int16_t current_y = 0;
+    // Runs are at least one pixel wide and tall, even when scaled down
+    int32_t right = x + prv_scale_to_int(prv_scale(glyph_width, multiplier)) + 1;
+    int32_t bottom = y + prv_scale_to_int(prv_scale(glyph_height, multiplier)) + 1;
+    const struct FontClip *clip = &out->clip;
+    if (right <= clip->x || bottom <= clip->y || x >= (int32_t)clip->x + clip->w || y >= (int32_t)clip->y + clip->h)
+        return;
 
-    while (remaining_size > 0 && current_y < glyph_height) {
-        uint8_t value_raw = *data++;
-        uint8_t value1 = (value_raw & 0xF0);
-        uint8_t value2 = (value_raw << 4);
-        uint8_t count1 = *data++;
-        uint8_t count2 = *data++;
-        remaining_size -= 2;
+    int16_t last_row = glyph_height;
+    while (last_row > 0 && y + prv_scale_to_int(prv_scale(last_row - 1, multiplier)) >= (int32_t)clip->y + clip->h)
+        last_row--;
 
-        prv_draw_rle_series(count1, value1, x, y, multiplier, glyph_width, &current_x, &current_y, color, line_callback);
-        prv_draw_rle_series(count2, value2, x, y, multiplier, glyph_width, &current_x, &current_y, color, line_callback);
+    const struct FontGlyphCacheEntry *entry = NULL;
+    if (out->target.glyph_cache != NULL) {
+        bool merged = out->target.span_buffer == NULL && out->target.rectangle_callback != NULL;
+        entry = prv_cache_glyph(out->target.glyph_cache, glyph, font, level, size, multiplier, merged);
     }
+    if (entry != NULL)
+        prv_replay_glyph(out->target.glyph_cache, entry, x, y, color, out);
+    else
+        prv_draw_glyph_data(glyph, font, level, size, x, y, multiplier, color, last_row, out);
+    prv_flush_open_rects(out, INT16_MAX);
 }
 
-void font_api_draw(uint16_t x, uint16_t y, enum FontAlign align, enum FontName font, const char *__restrict__ text, struct Color color, uint16_t pixel_size, font_draw_line_callback line_callback) {
+/*!
+ * \brief Chooses the glyph level of a font used to draw at a given size
+ *
+ * \details The smallest level at least as tall as the size is used, so that
+ *     glyphs are only scaled down, or the full size one for bigger sizes.
+ *
+ * \param[in] font Font name enumeration
+ * \param[in] pixel_size Vertical size of the text
+ *
+ * \return const struct FontLevel* The level to draw with, NULL if no font has this name
+ */
+EAGLETRT_STATIC_INLINE const struct FontLevel *prv_font_level(enum FontName font, uint16_t pixel_size) {
+    const struct Font *f = prv_font(font);
+    if (f == NULL)
+        return NULL;
+    uint8_t i = 0;
+    while (i + 1 < f->level_count && f->levels[i].height < pixel_size)
+        i++;
+    return &f->levels[i];
+}
+
+/*!
+ * \brief Finds the glyph of a character inside a glyph level
+ *
+ * \param[in] font Font name enumeration
+ * \param[in] level Glyph level of the font
+ * \param[in] c The character to find
+ *
+ * \return const struct Glyph* The glyph, NULL if the font does not have it
+ */
+EAGLETRT_STATIC_INLINE const struct Glyph *prv_find_glyph(enum FontName font, const struct FontLevel *level, char c) {
+    uint8_t index = prv_font(font)->glyph_index[(uint8_t)c];
+    return index != GLYPH_INDEX_NONE ? &level->glyphs[index] : NULL;
+}
+
+/*!
+ * \brief Computes the scaling multiplier of a glyph level for a given size
+ *
+ * \param[in] level Glyph level used to draw
+ * \param[in] pixel_size Vertical size of the text
+ *
+ * \return font_scale_t Multiplier from the generated glyphs to the given size
+ */
+EAGLETRT_STATIC_INLINE font_scale_t prv_font_multiplier(const struct FontLevel *level, uint16_t pixel_size) {
+    uint16_t glyph_height = level->height;
+#if RASTER_FIXED_POINT
+    // Rounded up, so that exact products are not truncated one pixel short
+    return glyph_height ? (((font_scale_t)pixel_size << FONT_SCALE_SHIFT) + glyph_height - 1) / glyph_height : (font_scale_t)1 << FONT_SCALE_SHIFT;
+#else
+    return glyph_height ? (float)pixel_size / glyph_height : 1.0f;
+#endif
+}
+
+/*!
+ * \brief Computes the x offset to apply to a text given its alignment
+ *
+ * \param[in] align Alignment on x axis
+ * \param[in] width Width of the text in pixels
+ *
+ * \return uint16_t Offset to subtract from the x position
+ */
+EAGLETRT_STATIC_INLINE uint16_t prv_align_offset(enum FontAlign align, uint16_t width) {
+    if (align == FONT_ALIGN_CENTER)
+        return width / 2;
+    else if (align == FONT_ALIGN_RIGHT)
+        return width;
+    return 0;
+}
+
+/*!
+ * \brief Renders an already laid out string to the given output
+ *
+ * \param[in] x Position on x axis
+ * \param[in] y Position on y axis
+ * \param[in] align Alignment on x axis
+ * \param[in] layout The laid out text
+ * \param[in] color Base color of the text
+ * \param[in,out] out Destination of the drawn pixels
+ */
+static void prv_draw_layout(uint16_t x, uint16_t y, enum FontAlign align, const struct FontLayout *layout, struct Color color, struct FontOutput *out) {
+    // Signed, so that text moved left of the screen by the alignment is clipped
+    int32_t origin = (int32_t)x - prv_align_offset(align, layout->width);
+    const struct FontLevel *level = prv_font_level(layout->font, layout->size);
+    if (level == NULL)
+        return;
+    font_scale_t multiplier = prv_font_multiplier(level, layout->size);
+    const struct Glyph *glyphs = level->glyphs;
+
+    for (uint16_t i = 0; i < layout->count; i++) {
+        const struct FontLayoutGlyph *g = &layout->glyphs[i];
+        if (origin + g->x >= (int32_t)out->clip.x + out->clip.w)
+            break;
+        prv_render_glyph(&glyphs[g->index], layout->font, level, layout->size, origin + g->x, y, multiplier, color, out);
+    }
+}
+
+/*!
+ * \brief Lays out and renders a string to the given output
+ *
+ * \details Aligned text is laid out once on the stack, so that glyphs are
+ *     looked up a single time. Left aligned text, and text too long for the
+ *     stack layout, is drawn while walking the string.
+ *
+ * \param[in] x Position on x axis
+ * \param[in] y Position on y axis
+ * \param[in] align Alignment on x axis
+ * \param[in] font Font name enumeration
+ * \param[in] text Pointer to text to draw
+ * \param[in] color Base color of the text
+ * \param[in] pixel_size Vertical size of the text
+ * \param[in,out] out Destination of the drawn pixels
+ */
+static void prv_draw_text(uint16_t x, uint16_t y, enum FontAlign align, enum FontName font, const char *__restrict__ text, struct Color color, uint16_t pixel_size, struct FontOutput *out) {
     // Adjust x position based on alignment
+    int32_t pen = x;
     if (align != FONT_ALIGN_LEFT) {
-        uint16_t len = font_api_length(text, pixel_size, font);
-        if (align == FONT_ALIGN_CENTER)
-            x -= len / 2;
-        else if (align == FONT_ALIGN_RIGHT)
-            x -= len;
+        struct FontLayoutGlyph glyphs[FONT_LAYOUT_STACK_GLYPHS];
+        struct FontLayout layout = { .glyphs = glyphs, .capacity = FONT_LAYOUT_STACK_GLYPHS };
+        if (font_api_layout(text, font, pixel_size, &layout)) {
+            prv_draw_layout(x, y, align, &layout, color, out);
+            return;
+        }
+        pen -= prv_align_offset(align, font_api_length(text, pixel_size, font));
     }
 
     // Calculate scaling multiplier
-    uint8_t glyph_height = fonts[font].glyphs[0].height;
-    float multiplier = glyph_height ? (float)pixel_size / glyph_height : 1.0f;
+    const struct FontLevel *level = prv_font_level(font, pixel_size);
+    if (level == NULL)
+        return;
+    font_scale_t multiplier = prv_font_multiplier(level, pixel_size);
 
     // Render each character in the text
     register char c;
-    while ((c = *text++)) {
-        const struct Glyph *glyph = find_glyph(font, c);
+    while ((c = *text++) && pen < (int32_t)out->clip.x + out->clip.w) {
+        const struct Glyph *glyph = prv_find_glyph(font, level, c);
         if (glyph != 0) {
-            prv_render_glyph(glyph, font, x, y, multiplier, color, line_callback);
-            x += glyph->width * multiplier;
+            prv_render_glyph(glyph, font, level, pixel_size, pen, y, multiplier, color, out);
+            pen += prv_scale_to_int(prv_scale(glyph->width, multiplier));
         }
     }
 }
 
+const struct Glyph *find_glyph(enum FontName font, char c) {
+    const struct Font *f = prv_font(font);
+    if (f == NULL)
+        return NULL;
+    uint8_t index = f->glyph_index[(uint8_t)c];
+    return index != GLYPH_INDEX_NONE ? &f->glyphs[index] : NULL;
+}
+
+void font_api_draw(uint16_t x, uint16_t y, enum FontAlign align, enum FontName font, const char *__restrict__ text, struct Color color, uint16_t pixel_size, font_draw_line_callback line_callback) {
+    struct FontOutput out;
+    prv_output_init(&out, &(struct FontTarget){ .line_callback = line_callback });
+    prv_draw_text(x, y, align, font, text, color, pixel_size, &out);
+}
+
+void font_api_draw_spans(uint16_t x, uint16_t y, enum FontAlign align, enum FontName font, const char *__restrict__ text, struct Color color, uint16_t pixel_size, struct FontSpanBuffer *buffer) {
+    if (buffer == NULL || buffer->spans == NULL || buffer->capacity == 0)
+        return;
+    struct FontOutput out;
+    prv_output_init(&out, &(struct FontTarget){ .span_buffer = buffer });
+    prv_draw_text(x, y, align, font, text, color, pixel_size, &out);
+    font_api_flush_spans(buffer);
+}
+
+void font_api_draw_rectangles(uint16_t x, uint16_t y, enum FontAlign align, enum FontName font, const char *__restrict__ text, struct Color color, uint16_t pixel_size, font_draw_rectangle_callback rectangle_callback) {
+    if (rectangle_callback == NULL)
+        return;
+    struct FontOutput out;
+    prv_output_init(&out, &(struct FontTarget){ .rectangle_callback = rectangle_callback });
+    prv_draw_text(x, y, align, font, text, color, pixel_size, &out);
+}
+
+void font_api_draw_target(uint16_t x, uint16_t y, enum FontAlign align, enum FontName font, const char *__restrict__ text, struct Color color, uint16_t pixel_size, const struct FontTarget *target) {
+    if (target == NULL)
+        return;
+    struct FontOutput out;
+    prv_output_init(&out, target);
+    prv_draw_text(x, y, align, font, text, color, pixel_size, &out);
+    font_api_flush_spans(target->span_buffer);
+}
+
+bool font_api_layout(const char *__restrict__ text, enum FontName font, uint16_t pixel_size, struct FontLayout *layout) {
+    if (layout == NULL || text == NULL)
+        return false;
+    const struct FontLevel *level = prv_font_level(font, pixel_size);
+    if (level == NULL)
+        return false;
+    font_scale_t multiplier = prv_font_multiplier(level, pixel_size);
+    const struct Glyph *glyphs = level->glyphs;
+
+    font_scale_t tot = 0;
+    uint16_t pen = 0;
+    layout->font = font;
+    layout->size = pixel_size;
+    layout->count = 0;
+
+    register char c;
+    while ((c = *text++)) {
+        const struct Glyph *glyph = prv_find_glyph(font, level, c);
+        if (glyph == 0)
+            continue;
+        if (layout->count == layout->capacity)
+            return false;
+        font_scale_t advance = prv_scale(glyph->width, multiplier);
+        layout->glyphs[layout->count++] = (struct FontLayoutGlyph){ pen, (uint8_t)(glyph - glyphs) };
+        pen += prv_scale_to_int(advance);
+        tot += advance;
+    }
+    layout->width = prv_scale_to_int(tot);
+    layout->end = pen;
+    return true;
+}
+
+void font_api_draw_layout(uint16_t x, uint16_t y, enum FontAlign align, const struct FontLayout *layout, struct Color color, const struct FontTarget *target) {
+    if (layout == NULL || target == NULL)
+        return;
+    struct FontOutput out;
+    prv_output_init(&out, target);
+    prv_draw_layout(x, y, align, layout, color, &out);
+    font_api_flush_spans(target->span_buffer);
+}
+
+void font_api_blend_palette(struct Color color, struct Color background, uint32_t *palette) {
+    if (palette == NULL)
+        return;
+    for (uint8_t i = 0; i < FONT_PALETTE_SIZE; i++) {
+        // Same coverage as the alpha of non paletted pixels
+        uint32_t a = (uint32_t)i << 4;
+        struct Color c = { .a = 0xff };
+        c.r = (uint8_t)((color.r * a + background.r * (255 - a) + 127) / 255);
+        c.g = (uint8_t)((color.g * a + background.g * (255 - a) + 127) / 255);
+        c.b = (uint8_t)((color.b * a + background.b * (255 - a) + 127) / 255);
+        palette[i] = c.argb;
+    }
+}
+
+void font_api_glyph_cache_init(struct FontGlyphCache *cache, struct FontGlyphCacheEntry *entries, uint16_t entry_capacity, struct FontGlyphRun *runs, uint32_t run_capacity) {
+    if (cache == NULL)
+        return;
+    cache->entries = entries;
+    cache->entry_capacity = entries != NULL && runs != NULL ? entry_capacity : 0;
+    cache->runs = runs;
+    cache->run_capacity = runs != NULL ? run_capacity : 0;
+    font_api_glyph_cache_clear(cache);
+}
+
+void font_api_glyph_cache_clear(struct FontGlyphCache *cache) {
+    if (cache == NULL)
+        return;
+    cache->entry_count = 0;
+    cache->run_count = 0;
+    cache->clock = 0;
+    cache->hits = 0;
+    cache->misses = 0;
+}
+
+void font_api_flush_spans(struct FontSpanBuffer *buffer) {
+    if (buffer == NULL || buffer->count == 0)
+        return;
+    buffer->callback(buffer->spans, buffer->count);
+    buffer->count = 0;
+}
+
 uint16_t font_api_length(const char *__restrict__ text, uint16_t pixel_size, enum FontName font) {
-    float tot = 0;
-    uint8_t glyph_height = fonts[font].glyphs[0].height;
-    float multiplier = glyph_height ? (float)pixel_size / glyph_height : 1.0f;
+    font_scale_t tot = 0;
+    const struct FontLevel *level = prv_font_level(font, pixel_size);
+    if (level == NULL)
+        return 0;
+    font_scale_t multiplier = prv_font_multiplier(level, pixel_size);
 
     register char c;
     while ((c = *text++)) {
-        const struct Glyph *glyph = find_glyph(font, c);
+        const struct Glyph *glyph = prv_find_glyph(font, level, c);
         if (glyph != 0) {
-            tot += glyph->width * multiplier;
+            tot += prv_scale(glyph->width, multiplier);
+        }
+    }
+    return prv_scale_to_int(tot);
+}
+
+/*!
+ * \brief Reads a 16 bits little endian value of a font pack
+ *
+ * \param[in] data Pointer to the value
+ *
+ * \return uint16_t The value
+ */
+EAGLETRT_STATIC_INLINE uint16_t prv_pack_read16(const uint8_t *data) {
+    return (uint16_t)(data[0] | (data[1] << 8));
+}
+
+/*!
+ * \brief Reads a 32 bits little endian value of a font pack
+ *
+ * \param[in] data Pointer to the value
+ *
+ * \return uint32_t The value
+ */
+EAGLETRT_STATIC_INLINE uint32_t prv_pack_read32(const uint8_t *data) {
+    return (uint32_t)data[0] | ((uint32_t)data[1] << 8) | ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24);
+}
+
+/*!
+ * \brief Checks that a section lies inside a font pack
+ *
+ * \param[in] size Size of the pack
+ * \param[in] offset Offset of the section
+ * \param[in] length Length of the section
+ * \param[in] align Required alignment of the section
+ *
+ * \return bool
+ *     - true if the section is aligned and inside the pack
+ *     - false otherwise
+ */
+EAGLETRT_STATIC_INLINE bool prv_pack_range(uint32_t size, uint32_t offset, uint32_t length, uint32_t align) {
+    return offset % align == 0 && offset <= size && length <= size - offset;
+}
+
+/*!
+ * \brief Checks that the data of a glyph can be drawn without reading outside of it
+ *
+ * \param[in] glyph The glyph to check
+ * \param[in] data Glyph data of its level
+ * \param[in] data_size Size of the glyph data of its level
+ * \param[in] format Layout of the glyph data
+ *
+ * \return bool
+ *     - true if the glyph is valid
+ *     - false otherwise
+ */
+static bool prv_pack_check_glyph(const struct Glyph *glyph, const uint8_t *data, uint32_t data_size, uint8_t format) {
+    if (glyph->offset > data_size || glyph->size > data_size - glyph->offset)
+        return false;
+    data += glyph->offset;
+
+    if (format == FONT_FORMAT_SDF)
+        return glyph->size == (uint32_t)glyph->width * glyph->height;
+
+    // The decoders walk series with signed 16 bits rows and columns
+    if (glyph->width > INT16_MAX || glyph->height > INT16_MAX)
+        return false;
+    if (glyph->size != 0 && (glyph->width == 0 || glyph->height == 0))
+        return false;
+    if (format == FONT_FORMAT_RLE)
+        return glyph->size % 3 == 0;
+
+    // Every row starts where the previous one ends and holds whole pairs of series
+    uint32_t start = 2u * glyph->height;
+    if (glyph->size < start)
+        return false;
+    for (uint16_t row = 0; row < glyph->height; row++) {
+        uint32_t end = row + 1 < glyph->height ? prv_pack_read16(&data[2 * row + 2]) : glyph->size;
+        if (prv_pack_read16(&data[2 * row]) != start || end < start || end > glyph->size || (end - start) % 3 != 0)
+            return false;
+        start = end;
+    }
+    return true;
+}
+
+/*!
+ * \brief Validates a font record of a font pack
+ *
+ * \param[in] data Pointer to the pack
+ * \param[in] size Size of the pack
+ * \param[in] record Pointer to the font record
+ *
+ * \return bool
+ *     - true if the font is valid
+ *     - false otherwise
+ */
+static bool prv_pack_check_font(const uint8_t *data, uint32_t size, const uint8_t *record) {
+    uint8_t format = record[18];
+    uint8_t level_count = record[19];
+    uint16_t glyph_count = prv_pack_read16(&record[22]);
+    uint32_t index_offset = prv_pack_read32(&record[24]);
+    uint32_t levels_offset = prv_pack_read32(&record[28]);
+
+    if (memchr(record, '\0', FONT_PACK_NAME_SIZE) == NULL)
+        return false;
+    if (format > FONT_FORMAT_RLE_ROWS || level_count == 0 || glyph_count >= GLYPH_INDEX_NONE || record[20] >= record[21])
+        return false;
+    if (!prv_pack_range(size, index_offset, 256, 1) || !prv_pack_range(size, levels_offset, (uint32_t)level_count * FONT_PACK_LEVEL_SIZE, 4))
+        return false;
+    const uint8_t *index = &data[index_offset];
+    for (uint16_t c = 0; c < 256; c++)
+        if (index[c] != GLYPH_INDEX_NONE && index[c] >= glyph_count)
+            return false;
+
+    uint16_t previous_height = 0;
+    for (uint8_t l = 0; l < level_count; l++) {
+        const uint8_t *level = &data[levels_offset + l * FONT_PACK_LEVEL_SIZE];
+        uint16_t height = prv_pack_read16(&level[0]);
+        uint32_t glyphs_offset = prv_pack_read32(&level[4]);
+        uint32_t data_offset = prv_pack_read32(&level[8]);
+        uint32_t data_size = prv_pack_read32(&level[12]);
+        if (height <= previous_height || height > INT16_MAX)
+            return false;
+        if (!prv_pack_range(size, glyphs_offset, (uint32_t)glyph_count * FONT_PACK_GLYPH_SIZE, 4) || !prv_pack_range(size, data_offset, data_size, 1))
+            return false;
+
+        const struct Glyph *glyphs = (const struct Glyph *)(const void *)&data[glyphs_offset];
+        for (uint16_t g = 0; g < glyph_count; g++)
+            if (!prv_pack_check_glyph(&glyphs[g], &data[data_offset], data_size, format))
+                return false;
+        previous_height = height;
+    }
+    return true;
+}
+
+/*!
+ * \brief Builds the font of a validated font record
+ *
+ * \param[in] data Pointer to the pack
+ * \param[in] record Pointer to the font record
+ * \param[out] font The font to build
+ * \param[out] levels Storage for the glyph levels of the font
+ */
+static void prv_pack_build_font(const uint8_t *data, const uint8_t *record, struct Font *font, struct FontLevel *levels) {
+    uint8_t level_count = record[19];
+    uint32_t levels_offset = prv_pack_read32(&record[28]);
+    for (uint8_t l = 0; l < level_count; l++) {
+        const uint8_t *level = &data[levels_offset + l * FONT_PACK_LEVEL_SIZE];
+        levels[l] = (struct FontLevel){ prv_pack_read16(&level[0]), &data[prv_pack_read32(&level[8])], (const struct Glyph *)(const void *)&data[prv_pack_read32(&level[4])] };
+    }
+
+    uint16_t master = prv_pack_read16(&record[16]);
+    *font = (struct Font){ (uint8_t)(master > UINT8_MAX ? UINT8_MAX : master), levels[level_count - 1].sdf_data, levels[level_count - 1].glyphs, prv_pack_read16(&record[22]), &data[prv_pack_read32(&record[24])], levels, level_count, record[18], { record[20], record[21] } };
+}
+
+bool font_api_pack_load(struct FontPack *pack, const void *data, uint32_t size, struct Font *font_storage, uint8_t font_capacity, struct FontLevel *level_storage, uint16_t level_capacity) {
+    const uint8_t *bytes = data;
+    if (pack == NULL || bytes == NULL || (uintptr_t)bytes % 4 != 0 || size < FONT_PACK_HEADER_SIZE)
+        return false;
+
+    // Glyphs are used in place, so the pack must match the layout of struct Glyph
+    const uint16_t probe = 1;
+    if (*(const uint8_t *)&probe != 1 || sizeof(struct Glyph) != FONT_PACK_GLYPH_SIZE || offsetof(struct Glyph, offset) != 4 ||
+        offsetof(struct Glyph, size) != 8 || offsetof(struct Glyph, width) != 10 || offsetof(struct Glyph, height) != 12)
+        return false;
+
+    uint16_t font_count = prv_pack_read16(&bytes[6]);
+    if (memcmp(bytes, "LRFP", 4) != 0 || prv_pack_read16(&bytes[4]) != FONT_PACK_VERSION || prv_pack_read32(&bytes[8]) != size)
+        return false;
+    if (font_count > font_capacity || !prv_pack_range(size, FONT_PACK_HEADER_SIZE, (uint32_t)font_count * FONT_PACK_FONT_SIZE, 4))
+        return false;
+
+    // The storage is only written once the whole pack is known to be valid
+    uint32_t level_count = 0;
+    for (uint8_t i = 0; i < font_count; i++) {
+        const uint8_t *record = &bytes[FONT_PACK_HEADER_SIZE + i * FONT_PACK_FONT_SIZE];
+        if (!prv_pack_check_font(bytes, size, record))
+            return false;
+        level_count += record[19];
+    }
+    if (level_count > level_capacity)
+        return false;
+
+    level_count = 0;
+    for (uint8_t i = 0; i < font_count; i++) {
+        const uint8_t *record = &bytes[FONT_PACK_HEADER_SIZE + i * FONT_PACK_FONT_SIZE];
+        prv_pack_build_font(bytes, record, &font_storage[i], &level_storage[level_count]);
+        level_count += record[19];
+    }
+
+    *pack = (struct FontPack){ bytes, size, font_storage, (uint8_t)font_count, level_storage, (uint16_t)level_count };
+    prv_pack = *pack;
+    return true;
+}
+
+bool font_api_pack_find(const struct FontPack *pack, const char *name, enum FontName *font) {
+    if (pack == NULL || name == NULL)
+        return false;
+    for (uint8_t i = 0; i < pack->font_count; i++) {
+        if (strncmp((const char *)&pack->data[FONT_PACK_HEADER_SIZE + i * FONT_PACK_FONT_SIZE], name, FONT_PACK_NAME_SIZE) == 0) {
+            if (font != NULL)
+                *font = (enum FontName)(FONT_BUILTIN_COUNT + i);
+            return true;
         }
     }
-    return (uint16_t)tot;
+    return false;
 }
@@ -0,0 +1,394 @@
+/*!
+ * \file framebuffer-api.c
+ * \date 2026-10-16
+ * \author Alessandro Bridi [ale.bridi15@gmail.com]
+ *
+ * \brief Software framebuffer backend API functions implementations
+ *
+ * \details Colors are blended with out = (src * a + dst * (255 - a)) / 255,
+ *     rounded to nearest. Vectorized and scalar rows use the same integer
+ *     math, so the result does not depend on the instruction set.
+ */
+
+#include "framebuffer-api.h"
+#include "eagletrt.h"
+#include <stddef.h>
+#include <string.h>
+
+#if RASTER_FRAMEBUFFER_SIMD && defined(__AVX2__)
+#include <immintrin.h>
+#elif RASTER_FRAMEBUFFER_SIMD && defined(__SSE2__)
+#include <emmintrin.h>
+#elif RASTER_FRAMEBUFFER_SIMD && defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+/*!
+ * \brief Framebuffer drawn by the callbacks set with framebuffer_api_bind
+ */
+static struct Framebuffer *prv_bound = NULL;
+
+/*!
+ * \brief Divides by 255 rounding to nearest
+ *
+ * \param[in] value Dividend, at most 255 * 255
+ *
+ * \return uint8_t The quotient
+ */
+EAGLETRT_STATIC_INLINE uint8_t prv_div255(uint32_t value) {
+    value += 128;
+    return (uint8_t)((value + (value >> 8)) >> 8);
+}
+
+/*!
+ * \brief Blends a single channel
+ *
+ * \param[in] src Channel of the drawn color
+ * \param[in] dst Channel of the framebuffer
+ * \param[in] alpha Coverage of the drawn color
+ *
+ * \return uint8_t The blended channel
+ */
+EAGLETRT_STATIC_INLINE uint8_t prv_blend_channel(uint8_t src, uint8_t dst, uint8_t alpha) {
+    return prv_div255((uint32_t)src * alpha + (uint32_t)dst * (255 - alpha));
+}
+
+/*!
+ * \brief Converts a color to RGB565
+ *
+ * \param[in] color The color to convert
+ *
+ * \return uint16_t The RGB565 pixel
+ */
+EAGLETRT_STATIC_INLINE uint16_t prv_to_rgb565(struct Color color) {
+    return (uint16_t)(((color.r >> 3) << 11) | ((color.g >> 2) << 5) | (color.b >> 3));
+}
+
+/*!
+ * \brief Converts a color to luminance
+ *
+ * \param[in] color The color to convert
+ *
+ * \return uint8_t The L8 pixel
+ */
+EAGLETRT_STATIC_INLINE uint8_t prv_to_l8(struct Color color) {
+    return (uint8_t)((77u * color.r + 150u * color.g + 29u * color.b + 128u) >> 8);
+}
+
+/*!
+ * \brief Fills a row of ARGB8888 pixels
+ *
+ * \param[out] row First pixel to fill
+ * \param[in] length Number of pixels
+ * \param[in] argb Color of the pixels
+ */
+static void prv_fill_argb8888(uint32_t *row, uint16_t length, uint32_t argb) {
+    uint16_t i = 0;
+#if RASTER_FRAMEBUFFER_SIMD && defined(__AVX2__)
+    __m256i v = _mm256_set1_epi32((int32_t)argb);
+    for (; i + 8 <= length; i += 8)
+        _mm256_storeu_si256((__m256i *)&row[i], v);
+#elif RASTER_FRAMEBUFFER_SIMD && defined(__SSE2__)
+    __m128i v = _mm_set1_epi32((int32_t)argb);
+    for (; i + 4 <= length; i += 4)
+        _mm_storeu_si128((__m128i *)&row[i], v);
+#elif RASTER_FRAMEBUFFER_SIMD && defined(__ARM_NEON)
+    uint32x4_t v = vdupq_n_u32(argb);
+    for (; i + 4 <= length; i += 4)
+        vst1q_u32(&row[i], v);
+#endif
+    for (; i < length; i++)
+        row[i] = argb;
+}
+
+/*!
+ * \brief Blends a color over a row of ARGB8888 pixels
+ *
+ * \details The source alpha channel is treated as fully opaque, so that the
+ *     resulting alpha is a + dst_a * (255 - a) / 255.
+ *
+ * \param[in,out] row First pixel to blend
+ * \param[in] length Number of pixels
+ * \param[in] color Color to blend, coverage in the alpha channel
+ */
+static void prv_blend_argb8888(uint32_t *row, uint16_t length, struct Color color) {
+    uint8_t a = color.a;
+    uint16_t i = 0;
+#if RASTER_FRAMEBUFFER_SIMD && defined(__AVX2__)
+    // Lanes hold b, g, r, a of four pixels as 16 bit values
+    __m256i src = _mm256_setr_epi16(color.b * a, color.g * a, color.r * a, 255 * a,
+                                    color.b * a, color.g * a, color.r * a, 255 * a,
+                                    color.b * a, color.g * a, color.r * a, 255 * a,
+                                    color.b * a, color.g * a, color.r * a, 255 * a);
+    __m256i inv_v = _mm256_set1_epi16((int16_t)(255 - a));
+    __m256i round = _mm256_set1_epi16(128);
+    __m256i zero = _mm256_setzero_si256();
+    for (; i + 8 <= length; i += 8) {
+        // Unpack and pack work inside 128 bit lanes, so the pixel order is kept
+        __m256i dst = _mm256_loadu_si256((const __m256i *)&row[i]);
+        __m256i lo = _mm256_add_epi16(_mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(dst, zero), inv_v), src), round);
+        __m256i hi = _mm256_add_epi16(_mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(dst, zero), inv_v), src), round);
+        lo = _mm256_srli_epi16(_mm256_add_epi16(lo, _mm256_srli_epi16(lo, 8)), 8);
+        hi = _mm256_srli_epi16(_mm256_add_epi16(hi, _mm256_srli_epi16(hi, 8)), 8);
+        _mm256_storeu_si256((__m256i *)&row[i], _mm256_packus_epi16(lo, hi));
+    }
+#elif RASTER_FRAMEBUFFER_SIMD && defined(__SSE2__)
+    // Lanes hold b, g, r, a of two pixels as 16 bit values
+    __m128i src = _mm_setr_epi16(color.b * a, color.g * a, color.r * a, 255 * a,
+                                 color.b * a, color.g * a, color.r * a, 255 * a);
+    __m128i inv_v = _mm_set1_epi16((int16_t)(255 - a));
+    __m128i round = _mm_set1_epi16(128);
+    __m128i zero = _mm_setzero_si128();
+    for (; i + 4 <= length; i += 4) {
+        __m128i dst = _mm_loadu_si128((const __m128i *)&row[i]);
+        __m128i lo = _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(dst, zero), inv_v), src), round);
+        __m128i hi = _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(dst, zero), inv_v), src), round);
+        lo = _mm_srli_epi16(_mm_add_epi16(lo, _mm_srli_epi16(lo, 8)), 8);
+        hi = _mm_srli_epi16(_mm_add_epi16(hi, _mm_srli_epi16(hi, 8)), 8);
+        _mm_storeu_si128((__m128i *)&row[i], _mm_packus_epi16(lo, hi));
+    }
+#elif RASTER_FRAMEBUFFER_SIMD && defined(__ARM_NEON)
+    const uint16_t lanes[8] = { color.b * a, color.g * a, color.r * a, 255 * a,
+                                color.b * a, color.g * a, color.r * a, 255 * a };
+    uint16x8_t src = vld1q_u16(lanes);
+    uint16_t inv = 255 - a;
+    uint16x8_t round = vdupq_n_u16(128);
+    for (; i + 4 <= length; i += 4) {
+        uint8x16_t dst = vreinterpretq_u8_u32(vld1q_u32(&row[i]));
+        uint16x8_t lo = vaddq_u16(vmlaq_n_u16(src, vmovl_u8(vget_low_u8(dst)), inv), round);
+        uint16x8_t hi = vaddq_u16(vmlaq_n_u16(src, vmovl_u8(vget_high_u8(dst)), inv), round);
+        lo = vshrq_n_u16(vaddq_u16(lo, vshrq_n_u16(lo, 8)), 8);
+        hi = vshrq_n_u16(vaddq_u16(hi, vshrq_n_u16(hi, 8)), 8);
+        vst1q_u32(&row[i], vreinterpretq_u32_u8(vcombine_u8(vmovn_u16(lo), vmovn_u16(hi))));
+    }
+#endif
+    for (; i < length; i++) {
+        struct Color dst = { .argb = row[i] };
+        dst.b = prv_blend_channel(color.b, dst.b, a);
+        dst.g = prv_blend_channel(color.g, dst.g, a);
+        dst.r = prv_blend_channel(color.r, dst.r, a);
+        dst.a = prv_blend_channel(255, dst.a, a);
+        row[i] = dst.argb;
+    }
+}
+
+/*!
+ * \brief Fills a row of RGB565 pixels
+ *
+ * \param[out] row First pixel to fill
+ * \param[in] length Number of pixels
+ * \param[in] pixel RGB565 value of the pixels
+ */
+static void prv_fill_rgb565(uint16_t *row, uint16_t length, uint16_t pixel) {
+    uint16_t i = 0;
+#if RASTER_FRAMEBUFFER_SIMD && defined(__SSE2__)
+    __m128i v = _mm_set1_epi16((int16_t)pixel);
+    for (; i + 8 <= length; i += 8)
+        _mm_storeu_si128((__m128i *)&row[i], v);
+#elif RASTER_FRAMEBUFFER_SIMD && defined(__ARM_NEON)
+    uint16x8_t v = vdupq_n_u16(pixel);
+    for (; i + 8 <= length; i += 8)
+        vst1q_u16(&row[i], v);
+#endif
+    for (; i < length; i++)
+        row[i] = pixel;
+}
+
+/*!
+ * \brief Blends a color over a row of RGB565 pixels
+ *
+ * \details Vectorized rows hold one channel of eight pixels in 16 bit lanes,
+ *     widened to 8 bits, blended and narrowed back as the scalar code does.
+ *
+ * \param[in,out] row First pixel to blend
+ * \param[in] length Number of pixels
+ * \param[in] color Color to blend, coverage in the alpha channel
+ */
+static void prv_blend_rgb565(uint16_t *row, uint16_t length, struct Color color) {
+    uint8_t a = color.a;
+    uint16_t i = 0;
+#if RASTER_FRAMEBUFFER_SIMD && defined(__SSE2__)
+    __m128i src_r = _mm_set1_epi16((int16_t)(color.r * a + 128));
+    __m128i src_g = _mm_set1_epi16((int16_t)(color.g * a + 128));
+    __m128i src_b = _mm_set1_epi16((int16_t)(color.b * a + 128));
+    __m128i inv_v = _mm_set1_epi16((int16_t)(255 - a));
+    __m128i mask6 = _mm_set1_epi16(0x3F);
+    __m128i mask5 = _mm_set1_epi16(0x1F);
+    for (; i + 8 <= length; i += 8) {
+        __m128i p = _mm_loadu_si128((const __m128i *)&row[i]);
+        __m128i r = _mm_srli_epi16(p, 11);
+        __m128i g = _mm_and_si128(_mm_srli_epi16(p, 5), mask6);
+        __m128i b = _mm_and_si128(p, mask5);
+        // Replicate the high bits so that full white stays full white
+        r = _mm_or_si128(_mm_slli_epi16(r, 3), _mm_srli_epi16(r, 2));
+        g = _mm_or_si128(_mm_slli_epi16(g, 2), _mm_srli_epi16(g, 4));
+        b = _mm_or_si128(_mm_slli_epi16(b, 3), _mm_srli_epi16(b, 2));
+        r = _mm_add_epi16(_mm_mullo_epi16(r, inv_v), src_r);
+        g = _mm_add_epi16(_mm_mullo_epi16(g, inv_v), src_g);
+        b = _mm_add_epi16(_mm_mullo_epi16(b, inv_v), src_b);
+        r = _mm_srli_epi16(_mm_add_epi16(r, _mm_srli_epi16(r, 8)), 8);
+        g = _mm_srli_epi16(_mm_add_epi16(g, _mm_srli_epi16(g, 8)), 8);
+        b = _mm_srli_epi16(_mm_add_epi16(b, _mm_srli_epi16(b, 8)), 8);
+        p = _mm_or_si128(_mm_or_si128(_mm_slli_epi16(_mm_srli_epi16(r, 3), 11), _mm_slli_epi16(_mm_srli_epi16(g, 2), 5)), _mm_srli_epi16(b, 3));
+        _mm_storeu_si128((__m128i *)&row[i], p);
+    }
+#elif RASTER_FRAMEBUFFER_SIMD && defined(__ARM_NEON)
+    uint16x8_t src_r = vdupq_n_u16((uint16_t)(color.r * a + 128));
+    uint16x8_t src_g = vdupq_n_u16((uint16_t)(color.g * a + 128));
+    uint16x8_t src_b = vdupq_n_u16((uint16_t)(color.b * a + 128));
+    uint16_t inv = 255 - a;
+    uint16x8_t mask6 = vdupq_n_u16(0x3F);
+    uint16x8_t mask5 = vdupq_n_u16(0x1F);
+    for (; i + 8 <= length; i += 8) {
+        uint16x8_t p = vld1q_u16(&row[i]);
+        uint16x8_t r = vshrq_n_u16(p, 11);
+        uint16x8_t g = vandq_u16(vshrq_n_u16(p, 5), mask6);
+        uint16x8_t b = vandq_u16(p, mask5);
+        r = vorrq_u16(vshlq_n_u16(r, 3), vshrq_n_u16(r, 2));
+        g = vorrq_u16(vshlq_n_u16(g, 2), vshrq_n_u16(g, 4));
+        b = vorrq_u16(vshlq_n_u16(b, 3), vshrq_n_u16(b, 2));
+        r = vmlaq_n_u16(src_r, r, inv);
+        g = vmlaq_n_u16(src_g, g, inv);
+        b = vmlaq_n_u16(src_b, b, inv);
+        r = vshrq_n_u16(vaddq_u16(r, vshrq_n_u16(r, 8)), 8);
+        g = vshrq_n_u16(vaddq_u16(g, vshrq_n_u16(g, 8)), 8);
+        b = vshrq_n_u16(vaddq_u16(b, vshrq_n_u16(b, 8)), 8);
+        p = vorrq_u16(vorrq_u16(vshlq_n_u16(vshrq_n_u16(r, 3), 11), vshlq_n_u16(vshrq_n_u16(g, 2), 5)), vshrq_n_u16(b, 3));
+        vst1q_u16(&row[i], p);
+    }
+#endif
+    for (; i < length; i++) {
+        uint16_t p = row[i];
+        uint8_t r = (uint8_t)((p >> 11) << 3);
+        uint8_t g = (uint8_t)(((p >> 5) & 0x3F) << 2);
+        uint8_t b = (uint8_t)((p & 0x1F) << 3);
+        // Replicate the high bits so that full white stays full white
+        r |= r >> 5;
+        g |= g >> 6;
+        b |= b >> 5;
+        row[i] = prv_to_rgb565((struct Color){ .r = prv_blend_channel(color.r, r, a),
+                                               .g = prv_blend_channel(color.g, g, a),
+                                               .b = prv_blend_channel(color.b, b, a) });
+    }
+}
+
+/*!
+ * \brief Draws a horizontal run of pixels on a framebuffer
+ *
+ * \param[in,out] fb Pointer to the framebuffer
+ * \param[in] x X position of the first pixel, inside the framebuffer
+ * \param[in] y Y position of the row, inside the framebuffer
+ * \param[in] length Number of pixels, already clipped
+ * \param[in] color Color of the pixels
+ */
+static void prv_draw_row(struct Framebuffer *fb, uint16_t x, uint16_t y, uint16_t length, struct Color color) {
+    uint8_t *line = (uint8_t *)fb->pixels + (size_t)y * fb->stride;
+    switch (fb->format) {
+        case FRAMEBUFFER_ARGB8888: {
+            uint32_t *row = (uint32_t *)line + x;
+            if (color.a == 255)
+                prv_fill_argb8888(row, length, color.argb);
+            else
+                prv_blend_argb8888(row, length, color);
+            break;
+        }
+        case FRAMEBUFFER_RGB565: {
+            uint16_t *row = (uint16_t *)line + x;
+            if (color.a == 255)
+                prv_fill_rgb565(row, length, prv_to_rgb565(color));
+            else
+                prv_blend_rgb565(row, length, color);
+            break;
+        }
+        case FRAMEBUFFER_L8: {
+            uint8_t *row = line + x;
+            uint8_t luma = prv_to_l8(color);
+            if (color.a == 255) {
+                memset(row, luma, length);
+            } else {
+                for (uint16_t i = 0; i < length; i++)
+                    row[i] = prv_blend_channel(luma, row[i], color.a);
+            }
+            break;
+        }
+    }
+}
+
+/*!
+ * \brief Returns the size in bytes of a pixel of the given format
+ *
+ * \param[in] format Pixel format
+ *
+ * \return uint8_t Bytes per pixel
+ */
+EAGLETRT_STATIC_INLINE uint8_t prv_pixel_size(enum FramebufferFormat format) {
+    if (format == FRAMEBUFFER_ARGB8888)
+        return 4;
+    else if (format == FRAMEBUFFER_RGB565)
+        return 2;
+    return 1;
+}
+
+void framebuffer_api_init(struct Framebuffer *fb, void *pixels, uint16_t width, uint16_t height, uint32_t stride, enum FramebufferFormat format) {
+    if (fb == NULL)
+        return;
+    fb->pixels = pixels;
+    fb->width = width;
+    fb->height = height;
+    fb->stride = stride != 0 ? stride : (uint32_t)width * prv_pixel_size(format);
+    fb->format = format;
+    fb->clear_color = (struct Color){ .argb = 0xFF000000 };
+}
+
+void framebuffer_api_fill(struct Framebuffer *fb, uint16_t x, uint16_t y, uint16_t w, uint16_t h, struct Color color) {
+    if (fb == NULL || fb->pixels == NULL || color.a == 0 || x >= fb->width || y >= fb->height)
+        return;
+    if (w > fb->width - x)
+        w = fb->width - x;
+    if (h > fb->height - y)
+        h = fb->height - y;
+    for (uint16_t j = 0; j < h; j++)
+        prv_draw_row(fb, x, y + j, w, color);
+}
+
+void framebuffer_api_clear(struct Framebuffer *fb, struct Color color) {
+    color.a = 255;
+    framebuffer_api_fill(fb, 0, 0, UINT16_MAX, UINT16_MAX, color);
+}
+
+/*!
+ * \brief Draw line callback bound to the framebuffer
+ */
+static void prv_bound_draw_line(uint16_t x, uint16_t y, uint16_t lenght, struct Color color) {
+    framebuffer_api_fill(prv_bound, x, y, lenght, 1, color);
+}
+
+/*!
+ * \brief Draw rectangle callback bound to the framebuffer
+ */
+static void prv_bound_draw_rectangle(uint16_t x, uint16_t y, uint16_t w, uint16_t h, struct Color color) {
+    framebuffer_api_fill(prv_bound, x, y, w, h, color);
+}
+
+/*!
+ * \brief Clear screen callback bound to the framebuffer
+ */
+static void prv_bound_clear_screen(void) {
+    if (prv_bound != NULL)
+        framebuffer_api_clear(prv_bound, prv_bound->clear_color);
+}
+
+void framebuffer_api_bind(struct RasterHandler *hras, struct Framebuffer *fb) {
+    if (hras == NULL)
+        return;
+    prv_bound = fb;
+    hras->draw_line = prv_bound_draw_line;
+    hras->draw_rectangle = prv_bound_draw_rectangle;
+    hras->draw_text_rectangle = prv_bound_draw_rectangle;
+    hras->clear_screen = prv_bound_clear_screen;
+}
+
+void framebuffer_api_draw_spans(const struct FontSpan *spans, uint16_t count) {
+    for (uint16_t i = 0; i < count; i++)
+        framebuffer_api_fill(prv_bound, spans[i].x, spans[i].y, spans[i].length, 1, spans[i].color);
+}
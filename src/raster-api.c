@@ -15,23 +15,229 @@
 #include "raster-api.h"
 #include "fontutils-api.h"
 #include <stddef.h>
-#include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
-#include <inttypes.h>
+#if RASTER_THREADS > 1
+#include <pthread.h>
+#endif
+
+// The update queue and the tile counter use the __atomic builtins
+#ifndef __GNUC__
+#error "raster-api.c needs the __atomic builtins of GCC or Clang"
+#endif
 
 #define MAX_BUFFER_SIZE (128)
 
 /*!
- * \brief Internal function to format label data into a string buffer
+ * \brief Number of box positions fetched from the grid for each region
  *
- * \details Formats the label data according to its type and formatting options
+ * \details Regions overlapping more boxes fall back to a scan of the whole
+ *     interface.
+ */
+#define REGION_QUERY_SIZE (64)
+
+/*!
+ * \brief Size of the scratch buffer used to format numbers
  *
- * \param[in] label Pointer to the RasterLabel structure
- * \param[out] buffer Buffer to store the formatted string
+ * \details Fits the largest float (39 digits) with sign, dot and
+ *     RASTER_MAX_FLOAT_PRECISION decimals.
+ */
+#define NUMBER_BUFFER_SIZE (56)
+
+/*!
+ * \brief Two-digit strings for every value from 0 to 99
+ */
+static const char prv_digit_pairs[] = "00010203040506070809"
+                                      "10111213141516171819"
+                                      "20212223242526272829"
+                                      "30313233343536373839"
+                                      "40414243444546474849"
+                                      "50515253545556575859"
+                                      "60616263646566676869"
+                                      "70717273747576777879"
+                                      "80818283848586878889"
+                                      "90919293949596979899";
+
+/*!
+ * \brief Powers of ten up to RASTER_MAX_FLOAT_PRECISION
+ */
+static const uint32_t prv_pow10[] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000 };
+
+/*!
+ * \brief Writes the decimal digits of a number, right to left
+ *
+ * \param[in] value The number to write
+ * \param[in] end Pointer one past the last digit to write
+ *
+ * \return char* Pointer to the first written digit
+ */
+static char *prv_format_u32(uint32_t value, char *end) {
+    while (value >= 100) {
+        uint32_t pair = value % 100;
+        value /= 100;
+        end -= 2;
+        memcpy(end, &prv_digit_pairs[pair * 2], 2);
+    }
+    if (value >= 10) {
+        end -= 2;
+        memcpy(end, &prv_digit_pairs[value * 2], 2);
+    } else {
+        *--end = (char)('0' + value);
+    }
+    return end;
+}
+
+/*!
+ * \brief Writes exactly \c digits decimal digits of a number, right to left
+ *
+ * \details The number is padded with leading zeros.
+ *
+ * \param[in] value The number to write, lower than 10^digits
+ * \param[in] end Pointer one past the last digit to write
+ * \param[in] digits Number of digits to write
+ *
+ * \return char* Pointer to the first written digit
+ */
+static char *prv_format_u32_padded(uint32_t value, char *end, uint8_t digits) {
+    for (; digits >= 2; digits -= 2) {
+        uint32_t pair = value % 100;
+        value /= 100;
+        end -= 2;
+        memcpy(end, &prv_digit_pairs[pair * 2], 2);
+    }
+    if (digits > 0)
+        *--end = (char)('0' + value % 10);
+    return end;
+}
+
+/*!
+ * \brief Writes the decimal digits of mantissa * 2^shift, right to left
+ *
+ * \details Used for the integer part of floats too large for 32 bits.
+ *
+ * \param[in] mantissa Mantissa of the float (at most 24 bits)
+ * \param[in] shift Power of two to multiply by (at most 104)
+ * \param[in] end Pointer one past the last digit to write
+ *
+ * \return char* Pointer to the first written digit
+ */
+static char *prv_format_big(uint32_t mantissa, uint8_t shift, char *end) {
+    uint32_t limbs[5] = { 0 };
+    uint8_t limb = shift / 32;
+    uint8_t bit = shift % 32;
+    limbs[limb] = mantissa << bit;
+    if (bit != 0)
+        limbs[limb + 1] = mantissa >> (32 - bit);
+
+    int8_t top = 4;
+    while (top > 0 && limbs[top] == 0)
+        top--;
+
+    // Divide by 10^9 until the number fits in a single chunk
+    while (top > 0 || limbs[0] >= 1000000000) {
+        uint64_t rem = 0;
+        for (int8_t i = top; i >= 0; i--) {
+            uint64_t cur = (rem << 32) | limbs[i];
+            limbs[i] = (uint32_t)(cur / 1000000000);
+            rem = cur % 1000000000;
+        }
+        end = prv_format_u32_padded((uint32_t)rem, end, 9);
+        while (top > 0 && limbs[top] == 0)
+            top--;
+    }
+    return prv_format_u32(limbs[0], end);
+}
+
+/*!
+ * \brief Writes a float with a fixed number of decimals, right to left
+ *
+ * \details Produces the same output as printf("%.*f"), rounding the exact
+ *     binary value half to even, without relying on the C library.
+ *
+ * \param[in] value The float to write
+ * \param[in] precision Number of decimals, at most RASTER_MAX_FLOAT_PRECISION
+ * \param[in] end Pointer one past the last character to write
+ *
+ * \return char* Pointer to the first written character
+ */
+static char *prv_format_float(float value, uint8_t precision, char *end) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    bool negative = (bits >> 31) != 0;
+    uint32_t exponent = (bits >> 23) & 0xff;
+    uint32_t mantissa = bits & 0x7fffff;
+
+    if (exponent == 0xff) {
+        const char *special = mantissa ? "nan" : "inf";
+        end -= 3;
+        memcpy(end, special, 3);
+    } else {
+        // value = mantissa * 2^shift
+        if (exponent == 0)
+            exponent = 1;
+        else
+            mantissa |= 0x800000;
+        int16_t shift = (int16_t)exponent - 150;
+
+        if (shift >= 0) {
+            end = prv_format_u32_padded(0, end, precision);
+            if (precision > 0)
+                *--end = '.';
+            end = prv_format_big(mantissa, (uint8_t)shift, end);
+        } else {
+            uint8_t k = (uint8_t)-shift;
+            uint32_t integer = k < 32 ? mantissa >> k : 0;
+            uint32_t fraction = k < 32 ? mantissa & ((1UL << k) - 1) : mantissa;
+            uint32_t pow10 = prv_pow10[precision];
+
+            // fraction * 10^precision / 2^k, rounded half to even
+            uint64_t scaled = (uint64_t)fraction * pow10;
+            uint32_t decimals = 0;
+            if (k < 64) {
+                decimals = (uint32_t)(scaled >> k);
+                uint64_t rest = scaled & ((1ULL << k) - 1);
+                uint64_t half = 1ULL << (k - 1);
+                uint32_t last = precision > 0 ? decimals : integer;
+                if (rest > half || (rest == half && (last & 1)))
+                    decimals++;
+            }
+            if (decimals == pow10) {
+                decimals = 0;
+                integer++;
+            }
+
+            if (precision > 0) {
+                end = prv_format_u32_padded(decimals, end, precision);
+                *--end = '.';
+            }
+            end = prv_format_u32(integer, end);
+        }
+    }
+
+    if (negative)
+        *--end = '-';
+    return end;
+}
+
+/*!
+ * \brief Copies a formatted number into the output buffer
+ *
+ * \details Truncates the text to the buffer size like snprintf.
+ *
+ * \param[in] start First character of the text
+ * \param[in] end Pointer one past the last character of the text
+ * \param[out] buffer Buffer to store the string
  * \param[in] buffer_size Size of the buffer
  */
-static void prv_format_label_data(const struct RasterLabel *label, char *buffer, size_t buffer_size) {
+static void prv_copy_number(const char *start, const char *end, char *buffer, size_t buffer_size) {
+    size_t len = (size_t)(end - start);
+    if (len > buffer_size - 1)
+        len = buffer_size - 1;
+    memcpy(buffer, start, len);
+    buffer[len] = '\0';
+}
+
+void raster_api_format_label(const struct RasterLabel *label, char *buffer, size_t buffer_size) {
     if (label == NULL || buffer == NULL || buffer_size == 0) {
         if (buffer != NULL && buffer_size > 0) {
             buffer[0] = '\0';
@@ -42,17 +248,28 @@ static void prv_format_label_data(const struct RasterLabel *label, char *buffer,
     switch (label->type) {
         case LABEL_DATA_INT: {
             const struct RasterIntFormat *fmt = &label->format.int_fmt;
-            if (fmt->is_unsigned) {
-                snprintf(buffer, buffer_size, "%" PRIu32, (uint32_t)label->data.int_val);
+            char number[NUMBER_BUFFER_SIZE];
+            char *end = number + sizeof(number);
+            char *start;
+            if (fmt->is_unsigned || label->data.int_val >= 0) {
+                start = prv_format_u32((uint32_t)label->data.int_val, end);
             } else {
-                snprintf(buffer, buffer_size, "%" PRId32, label->data.int_val);
+                start = prv_format_u32(0U - (uint32_t)label->data.int_val, end);
+                *--start = '-';
             }
+            prv_copy_number(start, end, buffer, buffer_size);
             break;
         }
 
         case LABEL_DATA_FLOAT: {
             const struct RasterFloatFormat *fmt = &label->format.float_fmt;
-            snprintf(buffer, buffer_size, "%.*f", fmt->precision, label->data.float_val);
+            uint8_t precision = fmt->precision;
+            if (precision > RASTER_MAX_FLOAT_PRECISION)
+                precision = RASTER_MAX_FLOAT_PRECISION;
+            char number[NUMBER_BUFFER_SIZE];
+            char *end = number + sizeof(number);
+            char *start = prv_format_float(label->data.float_val, precision, end);
+            prv_copy_number(start, end, buffer, buffer_size);
             break;
         }
 
@@ -76,38 +293,589 @@ static void prv_format_label_data(const struct RasterLabel *label, char *buffer,
     }
 }
 
+/*!
+ * \brief Checks if the formatted text of a label differs from the last render
+ *
+ * \param[in] label Pointer to the RasterLabel structure
+ *
+ * \return bool
+ *     - true if the label would be drawn differently
+ *     - false if the visible text is unchanged
+ */
+static bool prv_label_changed(const struct RasterLabel *label) {
+    if (!label->cache.valid)
+        return true;
+    char buf[MAX_BUFFER_SIZE];
+    raster_api_format_label(label, buf, sizeof(buf));
+    return strcmp(buf, label->cache.text) != 0;
+}
+
+/*!
+ * \brief Stores the text to render and its layout inside the label
+ *
+ * \details The layout is computed only when the text, font or size changed
+ *     since the last render.
+ *
+ * \param[in,out] label Pointer to the RasterLabel structure
+ * \param[in] text The text about to be drawn
+ *
+ * \return bool
+ *     - true if the cached layout can be used to draw the text
+ *     - false if the text does not fit in the cache
+ */
+static bool prv_label_cache(struct RasterLabel *label, const char *text) {
+    struct RasterLabelCache *cache = &label->cache;
+    cache->layout.glyphs = cache->glyphs;
+    cache->layout.capacity = RASTER_LABEL_CACHE_SIZE;
+    if (cache->valid && cache->layout.font == label->font && cache->layout.size == label->size && strcmp(text, cache->text) == 0)
+        return true;
+
+    size_t len = strlen(text);
+    cache->valid = len < sizeof(cache->text) && font_api_layout(text, label->font, label->size, &cache->layout);
+    if (cache->valid)
+        memcpy(cache->text, text, len + 1);
+    return cache->valid;
+}
+
+/*!
+ * \brief Checks if two rectangles overlap or share an edge
+ *
+ * \param[in] a First rectangle
+ * \param[in] b Second rectangle
+ *
+ * \return bool
+ *     - true if the rectangles overlap or are adjacent
+ *     - false otherwise
+ */
+static bool prv_rect_touches(const struct RasterRect *a, const struct RasterRect *b) {
+    return (uint32_t)a->x <= (uint32_t)b->x + b->w && (uint32_t)b->x <= (uint32_t)a->x + a->w &&
+           (uint32_t)a->y <= (uint32_t)b->y + b->h && (uint32_t)b->y <= (uint32_t)a->y + a->h;
+}
+
+/*!
+ * \brief Computes the bounding rectangle of two rectangles
+ *
+ * \param[in] a First rectangle
+ * \param[in] b Second rectangle
+ *
+ * \return struct RasterRect Smallest rectangle containing both
+ */
+static struct RasterRect prv_rect_union(const struct RasterRect *a, const struct RasterRect *b) {
+    uint16_t x0 = a->x < b->x ? a->x : b->x;
+    uint16_t y0 = a->y < b->y ? a->y : b->y;
+    uint32_t x1 = (uint32_t)a->x + a->w > (uint32_t)b->x + b->w ? (uint32_t)a->x + a->w : (uint32_t)b->x + b->w;
+    uint32_t y1 = (uint32_t)a->y + a->h > (uint32_t)b->y + b->h ? (uint32_t)a->y + a->h : (uint32_t)b->y + b->h;
+    return (struct RasterRect){ x0, y0, (uint16_t)(x1 - x0), (uint16_t)(y1 - y0) };
+}
+
+/*!
+ * \brief Computes the area of a rectangle
+ *
+ * \param[in] r The rectangle
+ *
+ * \return uint32_t Area in pixels
+ */
+static uint32_t prv_rect_area(const struct RasterRect *r) {
+    return (uint32_t)r->w * r->h;
+}
+
+/*!
+ * \brief Restricts a rectangle to the area of another one
+ *
+ * \param[in,out] r The rectangle to clip
+ * \param[in] clip The clipping area
+ *
+ * \return bool
+ *     - true if part of the rectangle is left
+ *     - false if the rectangle is completely outside
+ */
+static bool prv_rect_clip(struct RasterRect *r, const struct RasterRect *clip) {
+    uint32_t x0 = r->x > clip->x ? r->x : clip->x;
+    uint32_t y0 = r->y > clip->y ? r->y : clip->y;
+    uint32_t x1 = (uint32_t)r->x + r->w < (uint32_t)clip->x + clip->w ? (uint32_t)r->x + r->w : (uint32_t)clip->x + clip->w;
+    uint32_t y1 = (uint32_t)r->y + r->h < (uint32_t)clip->y + clip->h ? (uint32_t)r->y + r->h : (uint32_t)clip->y + clip->h;
+    if (x1 <= x0 || y1 <= y0)
+        return false;
+    *r = (struct RasterRect){ (uint16_t)x0, (uint16_t)y0, (uint16_t)(x1 - x0), (uint16_t)(y1 - y0) };
+    return true;
+}
+
+/*!
+ * \brief Checks if a rectangle lies completely inside another one
+ *
+ * \param[in] outer The containing rectangle
+ * \param[in] inner The contained rectangle
+ *
+ * \return bool
+ *     - true if every pixel of inner is inside outer
+ *     - false otherwise
+ */
+static bool prv_rect_contains(const struct RasterRect *outer, const struct RasterRect *inner) {
+    return inner->x >= outer->x && inner->y >= outer->y &&
+           (uint32_t)inner->x + inner->w <= (uint32_t)outer->x + outer->w &&
+           (uint32_t)inner->y + inner->h <= (uint32_t)outer->y + outer->h;
+}
+
+/*!
+ * \brief Checks if two rectangles share at least one pixel
+ *
+ * \param[in] a First rectangle
+ * \param[in] b Second rectangle
+ *
+ * \return bool
+ *     - true if the rectangles overlap
+ *     - false if they are disjoint, only adjacent or one of them is empty
+ */
+static bool prv_rect_overlaps(const struct RasterRect *a, const struct RasterRect *b) {
+    if (a->w == 0 || a->h == 0 || b->w == 0 || b->h == 0)
+        return false;
+    return (uint32_t)a->x < (uint32_t)b->x + b->w && (uint32_t)b->x < (uint32_t)a->x + a->w &&
+           (uint32_t)a->y < (uint32_t)b->y + b->h && (uint32_t)b->y < (uint32_t)a->y + a->h;
+}
+
+/*!
+ * \brief Computes the cells of a grid touched by a rectangle
+ *
+ * \param[in] grid The grid
+ * \param[in] r The rectangle
+ * \param[out] range First column, first row, last column and last row, inclusive
+ *
+ * \return bool
+ *     - true if the rectangle touches at least one cell
+ *     - false if it is empty or outside the grid
+ */
+static bool prv_grid_range(const struct RasterGrid *grid, const struct RasterRect *r, uint16_t range[4]) {
+    if (r->w == 0 || r->h == 0)
+        return false;
+    uint32_t x0 = r->x >> grid->cell_shift;
+    uint32_t y0 = r->y >> grid->cell_shift;
+    uint32_t x1 = ((uint32_t)r->x + r->w - 1) >> grid->cell_shift;
+    uint32_t y1 = ((uint32_t)r->y + r->h - 1) >> grid->cell_shift;
+    if (x0 >= grid->cols || y0 >= grid->rows)
+        return false;
+    range[0] = (uint16_t)x0;
+    range[1] = (uint16_t)y0;
+    range[2] = (uint16_t)(x1 < grid->cols ? x1 : grid->cols - 1u);
+    range[3] = (uint16_t)(y1 < grid->rows ? y1 : grid->rows - 1u);
+    return true;
+}
+
+/*!
+ * \brief Builds the spatial grid of the handler from the interface
+ *
+ * \details Counts the boxes of every cell, turns the counts into end
+ *     offsets, then fills the cells walking the interface backwards, so that
+ *     every offset ends at the start of its cell and entries stay sorted.
+ *
+ * \param[in,out] hras Pointer to the RasterHandler struct to update
+ */
+static void prv_build_grid(struct RasterHandler *hras) {
+    struct RasterGrid *grid = hras->grid;
+    if (grid == NULL)
+        return;
+    grid->valid = false;
+    if (grid->cells == NULL || grid->entries == NULL || (hras->interface == NULL && hras->size != 0) || grid->cell_shift > 15)
+        return;
+
+    uint32_t max_x = 0;
+    uint32_t max_y = 0;
+    for (uint16_t i = 0; i < hras->size; i++) {
+        const struct RasterRect *r = &hras->interface[i].rect;
+        if ((uint32_t)r->x + r->w > max_x)
+            max_x = (uint32_t)r->x + r->w;
+        if ((uint32_t)r->y + r->h > max_y)
+            max_y = (uint32_t)r->y + r->h;
+    }
+    uint32_t cell_size = 1u << grid->cell_shift;
+    uint32_t cols = (max_x + cell_size - 1) >> grid->cell_shift;
+    uint32_t rows = (max_y + cell_size - 1) >> grid->cell_shift;
+    uint32_t count = cols * rows;
+    if (count + 1 > grid->cell_capacity)
+        return;
+    grid->cols = (uint16_t)cols;
+    grid->rows = (uint16_t)rows;
+
+    uint32_t total = 0;
+    uint16_t range[4];
+    memset(grid->cells, 0, (count + 1) * sizeof(grid->cells[0]));
+    for (uint16_t i = 0; i < hras->size; i++) {
+        if (!prv_grid_range(grid, &hras->interface[i].rect, range))
+            continue;
+        total += (uint32_t)(range[2] - range[0] + 1) * (range[3] - range[1] + 1);
+        if (total > grid->entry_capacity)
+            return;
+        for (uint16_t cy = range[1]; cy <= range[3]; cy++)
+            for (uint16_t cx = range[0]; cx <= range[2]; cx++)
+                grid->cells[cy * cols + cx]++;
+    }
+
+    uint16_t sum = 0;
+    for (uint32_t c = 0; c < count; c++) {
+        sum += grid->cells[c];
+        grid->cells[c] = sum;
+    }
+    grid->cells[count] = sum;
+
+    for (uint16_t i = hras->size; i-- > 0;) {
+        if (!prv_grid_range(grid, &hras->interface[i].rect, range))
+            continue;
+        for (uint16_t cy = range[1]; cy <= range[3]; cy++)
+            for (uint16_t cx = range[0]; cx <= range[2]; cx++)
+                grid->entries[--grid->cells[cy * cols + cx]] = i;
+    }
+    grid->valid = true;
+}
+
+/*!
+ * \brief Checks if an area of a box is hidden by a box drawn after it
+ *
+ * \details Only a single opaque box covering the whole area is considered.
+ *     With a grid, only the boxes in the cell of the top-left corner of the
+ *     area are checked, as a covering box must contain that corner.
+ *
+ * \param[in] hras Pointer to the RasterHandler struct holding the interface
+ * \param[in] index Position of the box inside the interface
+ * \param[in] rect Area of the box to check
+ *
+ * \return bool
+ *     - true if drawing the area would be completely overdrawn
+ *     - false otherwise
+ */
+static bool prv_box_occluded(const struct RasterHandler *hras, uint16_t index, const struct RasterRect *rect) {
+    const struct RasterGrid *grid = hras->grid;
+    if (grid != NULL && grid->valid) {
+        uint16_t range[4];
+        if (!prv_grid_range(grid, rect, range))
+            return false;
+        uint16_t cell = range[1] * grid->cols + range[0];
+        // Entries are sorted, so the boxes above are at the end of the cell
+        for (uint16_t e = grid->cells[cell + 1]; e > grid->cells[cell] && grid->entries[e - 1] > index; e--) {
+            const struct RasterBox *above = &hras->interface[grid->entries[e - 1]];
+            if (above->color.a == 0xff && prv_rect_contains(&above->rect, rect))
+                return true;
+        }
+        return false;
+    }
+
+    for (uint16_t j = index + 1; j < hras->size; j++) {
+        const struct RasterBox *above = &hras->interface[j];
+        if (above->color.a == 0xff && prv_rect_contains(&above->rect, rect))
+            return true;
+    }
+    return false;
+}
+
+/*!
+ * \brief Forces the next draw of a box to redraw it completely
+ *
+ * \details Used when the pixels of the box on screen were overwritten, so
+ *     that its label is not drawn by redrawing only the changed glyphs.
+ *
+ * \param[in,out] box Pointer to the box to mark
+ */
+static void prv_box_invalidate(struct RasterBox *box) {
+    box->updated = true;
+    if (box->label != NULL)
+        box->label->cache.valid = false;
+}
+
+/*!
+ * \brief Skips a box hidden by a box drawn after it
+ *
+ * \details The covering box is drawn in its place, so the box is done with
+ *     until it is marked as updated again. Its pixels on screen are gone by
+ *     then, so its label is drawn completely.
+ *
+ * \param[in,out] box Pointer to the hidden box
+ */
+static void prv_box_hide(struct RasterBox *box) {
+    box->updated = false;
+    if (box->label != NULL)
+        box->label->cache.valid = false;
+}
+
+/*!
+ * \brief Marks the boxes drawn after a box and overlapping it as updated
+ *
+ * \details Keeps the stacking order when a box is redrawn in partial mode,
+ *     as the redrawn area would otherwise cover the boxes above it.
+ *
+ * \param[in,out] hras Pointer to the RasterHandler struct holding the interface
+ * \param[in] index Position of the redrawn box inside the interface
+ */
+static void prv_mark_boxes_above(struct RasterHandler *hras, uint16_t index) {
+    const struct RasterRect *rect = &hras->interface[index].rect;
+    const struct RasterGrid *grid = hras->grid;
+    if (grid != NULL && grid->valid) {
+        uint16_t range[4];
+        if (!prv_grid_range(grid, rect, range))
+            return;
+        for (uint16_t cy = range[1]; cy <= range[3]; cy++) {
+            for (uint16_t cx = range[0]; cx <= range[2]; cx++) {
+                uint16_t cell = cy * grid->cols + cx;
+                for (uint16_t e = grid->cells[cell + 1]; e > grid->cells[cell] && grid->entries[e - 1] > index; e--) {
+                    struct RasterBox *above = &hras->interface[grid->entries[e - 1]];
+                    if (prv_rect_overlaps(&above->rect, rect))
+                        prv_box_invalidate(above);
+                }
+            }
+        }
+        return;
+    }
+
+    for (uint16_t j = index + 1; j < hras->size; j++) {
+        struct RasterBox *above = &hras->interface[j];
+        if (prv_rect_overlaps(&above->rect, rect))
+            prv_box_invalidate(above);
+    }
+}
+
+/*!
+ * \brief Adds a redrawn area to the damage list of the handler
+ *
+ * \details The area is merged with every rectangle it overlaps or touches,
+ *     repeating until the list is stable. When the list is full, the area is
+ *     merged into the rectangle whose area grows the least.
+ *
+ * \param[in,out] hras Pointer to the RasterHandler struct to update
+ * \param[in] rect The redrawn area
+ */
+static void prv_damage_add(struct RasterHandler *hras, struct RasterRect rect) {
+    if (rect.w == 0 || rect.h == 0)
+        return;
+
+    bool merged = true;
+    while (merged) {
+        merged = false;
+        for (uint16_t i = 0; i < hras->damage_count; i++) {
+            if (prv_rect_touches(&hras->damage[i], &rect)) {
+                rect = prv_rect_union(&hras->damage[i], &rect);
+                hras->damage[i] = hras->damage[--hras->damage_count];
+                merged = true;
+                break;
+            }
+        }
+
+        if (!merged && hras->damage_count == RASTER_MAX_DAMAGE_RECTS) {
+            uint16_t best = 0;
+            uint32_t best_growth = UINT32_MAX;
+            for (uint16_t i = 0; i < hras->damage_count; i++) {
+                struct RasterRect u = prv_rect_union(&hras->damage[i], &rect);
+                uint32_t growth = prv_rect_area(&u) - prv_rect_area(&hras->damage[i]);
+                if (growth < best_growth) {
+                    best_growth = growth;
+                    best = i;
+                }
+            }
+            rect = prv_rect_union(&hras->damage[best], &rect);
+            hras->damage[best] = hras->damage[--hras->damage_count];
+            merged = true;
+        }
+    }
+
+    hras->damage[hras->damage_count++] = rect;
+}
+
+/*!
+ * \brief Redraws only the glyphs of a label that changed since the last render
+ *
+ * \details Possible only when the box and label look the same as in the last
+ *     render and the new text has exactly the same glyph positions, so that
+ *     every changed glyph can be cleared and redrawn inside its own cell.
+ *     The cell is clipped to the box and the target clip is narrowed to it.
+ *
+ * \param[in,out] hras Pointer to the RasterHandler struct holding the callbacks
+ * \param[in] box Pointer to the box owning the label
+ * \param[in] text The new text of the label
+ * \param[in] target Callbacks used to draw the text
+ *
+ * \return bool
+ *     - true if the label has been updated
+ *     - false if the whole box has to be redrawn
+ */
+static bool prv_draw_label_diff(struct RasterHandler *hras, struct RasterBox *box, const char *text, const struct FontTarget *target) {
+    struct RasterLabel *label = box->label;
+    struct RasterLabelCache *cache = &label->cache;
+    uint16_t x = box->rect.x + label->pos.x;
+    uint16_t y = box->rect.y + label->pos.y;
+
+    if (RASTER_PARTIAL == 0 || !cache->valid)
+        return false;
+    if (cache->pos.x != x || cache->pos.y != y || cache->align != label->align ||
+        cache->color.argb != label->color.argb || cache->background.argb != box->color.argb ||
+        cache->layout.font != label->font || cache->layout.size != label->size)
+        return false;
+
+    size_t len = strlen(text);
+    if (len >= sizeof(cache->text))
+        return false;
+    struct FontLayoutGlyph glyphs[RASTER_LABEL_CACHE_SIZE];
+    struct FontLayout layout = { .glyphs = glyphs, .capacity = RASTER_LABEL_CACHE_SIZE };
+    if (!font_api_layout(text, label->font, label->size, &layout))
+        return false;
+
+    // Glyph cells must not move, otherwise the whole text shifts
+    const struct FontLayout *old = &cache->layout;
+    if (layout.count != old->count || layout.width != old->width || layout.end != old->end)
+        return false;
+    for (uint16_t i = 0; i < layout.count; i++) {
+        if (glyphs[i].x != old->glyphs[i].x)
+            return false;
+    }
+
+    int32_t origin = x;
+    if (label->align == FONT_ALIGN_CENTER)
+        origin -= layout.width / 2;
+    else if (label->align == FONT_ALIGN_RIGHT)
+        origin -= layout.width;
+
+    // Runs scaled below one pixel are still drawn one pixel wide and tall, so
+    // the ink of a glyph reaches one pixel past its cell on both axes
+    struct FontClip clip;
+    struct FontTarget cell_target = *target;
+    cell_target.clip = &clip;
+    for (uint16_t i = 0; i < layout.count; i++) {
+        if (glyphs[i].index == old->glyphs[i].index)
+            continue;
+        // Cells left of the screen are cut at zero instead of wrapping around
+        int32_t cell_x = origin + glyphs[i].x;
+        int32_t cell_end = origin + (i + 1 < layout.count ? glyphs[i + 1].x : layout.end) + 1;
+        if (cell_x < 0)
+            cell_x = 0;
+        struct RasterRect cell = { (uint16_t)cell_x, y, (uint16_t)(cell_end > cell_x ? cell_end - cell_x : 0), label->size + 1 };
+        if (!prv_rect_clip(&cell, &box->rect))
+            continue;
+        hras->draw_rectangle(cell.x, cell.y, cell.w, cell.h, box->color);
+        prv_damage_add(hras, cell);
+
+        // Neighbours reaching into the cell are drawn again in the same order
+        // as a full render, so that overlapping pixels blend the same way
+        clip = (struct FontClip){ cell.x, cell.y, cell.w, cell.h };
+        for (uint16_t j = 0; j < layout.count; j++) {
+            int32_t ink_x = origin + glyphs[j].x;
+            int32_t ink_end = origin + (j + 1 < layout.count ? glyphs[j + 1].x : layout.end) + 1;
+            if (ink_end <= cell.x || ink_x >= cell.x + cell.w)
+                continue;
+            struct FontLayout single = layout;
+            single.glyphs = &glyphs[j];
+            single.count = 1;
+            font_api_draw_layout(x, y, label->align, &single, label->color, &cell_target);
+        }
+    }
+
+    memcpy(cache->glyphs, glyphs, layout.count * sizeof(glyphs[0]));
+    memcpy(cache->text, text, len + 1);
+    return true;
+}
+
+/*!
+ * \brief Caches the layout of a label and the look of the box drawing it
+ *
+ * \param[in,out] box Pointer to the box owning the label
+ * \param[in] text The text about to be drawn
+ *
+ * \return bool
+ *     - true if the cached layout can be used to draw the text
+ *     - false if the text does not fit in the cache
+ */
+static bool prv_label_prepare(struct RasterBox *box, const char *text) {
+    struct RasterLabel *label = box->label;
+    if (!prv_label_cache(label, text))
+        return false;
+    label->cache.pos = (struct RasterCoords){ box->rect.x + label->pos.x, box->rect.y + label->pos.y };
+    label->cache.align = label->align;
+    label->cache.color = label->color;
+    label->cache.background = box->color;
+    return true;
+}
+
+/*!
+ * \brief Builds the callbacks used to draw the text of a box
+ *
+ * \param[in] hras Pointer to the RasterHandler struct holding the callbacks
+ * \param[in] box Pointer to the box owning the text
+ * \param[in] clip Area the text is restricted to
+ * \param[out] palette Storage for the pre-blended colors, if used
+ *
+ * \return struct FontTarget The text target
+ */
+static struct FontTarget prv_text_target(const struct RasterHandler *hras, const struct RasterBox *box, const struct FontClip *clip, uint32_t *palette) {
+    struct FontTarget target = { hras->draw_line, hras->draw_text_rectangle, hras->span_buffer, clip, NULL, hras->glyph_cache };
+    if (hras->opaque_text && box->label != NULL && box->color.a == 0xff) {
+        font_api_blend_palette(box->label->color, box->color, palette);
+        target.palette = palette;
+    }
+    return target;
+}
+
 /*!
  * \brief Draws a text box with background, value, and label
  *
  * \details This function draws a text box on the screen using the provided
  *     drawing callbacks. It handles background color, value formatting,
  *     threshold-based coloring, slider rendering, and label drawing.
+ *     When only some glyphs of the label changed, only those are redrawn.
+ *     Text is clipped to the box. Every drawn area is added to the damage
+ *     list of the handler.
  * 
+ * \param[in,out] hras Pointer to the RasterHandler struct holding the callbacks
  * \param[in] box Pointer to the Box structure containing the text box configuration
- * \param[in] draw_rectangle Callback function to draw rectangles
- * \param[in] line_callback Callback function to draw lines of text
  */
-void prv_draw_text_box(struct RasterBox *box, raster_draw_rectangle_callback draw_rectangle, font_draw_line_callback line_callback) {
-    if (RASTER_PARTIAL == 0 && !box->updated)
-        return;
-    // Draw the basic rectangle
-    draw_rectangle(box->rect.x, box->rect.y, box->rect.w, box->rect.h, box->color);
-    if (box->label == NULL)
+void prv_draw_text_box(struct RasterHandler *hras, struct RasterBox *box) {
+    if (RASTER_PARTIAL != 0 && !box->updated)
         return;
+    box->updated = false;
+    struct FontClip clip = { box->rect.x, box->rect.y, box->rect.w, box->rect.h };
+    uint32_t palette[FONT_PALETTE_SIZE];
+    struct FontTarget target = prv_text_target(hras, box, &clip, palette);
 
     // Format the value using the internal formatting function
     char buf[MAX_BUFFER_SIZE];
-    prv_format_label_data(box->label, buf, sizeof(buf));
+    struct RasterLabel *label = box->label;
+    if (label != NULL) {
+        raster_api_format_label(label, buf, sizeof(buf));
+        if (prv_draw_label_diff(hras, box, buf, &target))
+            return;
+    }
+
+    // Draw the basic rectangle
+    hras->draw_rectangle(box->rect.x, box->rect.y, box->rect.w, box->rect.h, box->color);
+    prv_damage_add(hras, box->rect);
+    if (label == NULL)
+        return;
 
     // Plot the value
-    font_api_draw(box->rect.x + box->label->pos.x,
-                  box->rect.y + box->label->pos.y,
-                  box->label->align,
-                  box->label->font,
-                  buf,
-                  box->label->color,
-                  box->label->size,
-                  line_callback);
+    uint16_t x = box->rect.x + label->pos.x;
+    uint16_t y = box->rect.y + label->pos.y;
+    if (prv_label_prepare(box, buf)) {
+        font_api_draw_layout(x, y, label->align, &label->cache.layout, label->color, &target);
+    } else {
+        font_api_draw_target(x, y, label->align, label->font, buf, label->color, label->size, &target);
+    }
+}
+
+/*!
+ * \brief Builds the index of the interface sorted by box id
+ *
+ * \details Uses an insertion sort, which is linear when the interface is
+ *     already ordered by id.
+ *
+ * \param[in,out] hras Pointer to the RasterHandler struct to update
+ */
+static void prv_build_index(struct RasterHandler *hras) {
+    hras->index_valid = hras->index != NULL && hras->interface != NULL && hras->size <= hras->index_capacity;
+    if (!hras->index_valid)
+        return;
+
+    for (uint16_t i = 0; i < hras->size; i++) {
+        uint16_t id = hras->interface[i].id;
+        uint16_t j = i;
+        while (j > 0 && hras->interface[hras->index[j - 1]].id > id) {
+            hras->index[j] = hras->index[j - 1];
+            j--;
+        }
+        hras->index[j] = i;
+    }
 }
 
 void raster_api_init(struct RasterHandler *hras, struct RasterBox *interface, uint16_t size, font_draw_line_callback draw_line, raster_draw_rectangle_callback draw_rectangle, raster_clear_screen_callback clear_screen) {
@@ -118,6 +886,17 @@ void raster_api_init(struct RasterHandler *hras, struct RasterBox *interface, ui
     hras->draw_line = draw_line;
     hras->draw_rectangle = draw_rectangle;
     hras->clear_screen = clear_screen;
+    hras->span_buffer = NULL;
+    hras->draw_text_rectangle = NULL;
+    hras->opaque_text = false;
+    hras->glyph_cache = NULL;
+    hras->index = NULL;
+    hras->index_capacity = 0;
+    hras->index_valid = false;
+    hras->grid = NULL;
+    hras->queue = NULL;
+    hras->workers = NULL;
+    hras->damage_count = 0;
 }
 
 void raster_api_set_interface(struct RasterHandler *hras, struct RasterBox *interface, uint16_t size) {
@@ -125,16 +904,377 @@ void raster_api_set_interface(struct RasterHandler *hras, struct RasterBox *inte
         return;
     hras->interface = interface;
     hras->size = size;
+    hras->damage_count = 0;
+    prv_build_index(hras);
+    prv_build_grid(hras);
+}
+
+void raster_api_set_index(struct RasterHandler *hras, uint16_t *storage, uint16_t capacity) {
+    if (hras == NULL)
+        return;
+    hras->index = storage;
+    hras->index_capacity = capacity;
+    prv_build_index(hras);
+}
+
+void raster_api_set_span_buffer(struct RasterHandler *hras, struct FontSpanBuffer *buffer) {
+    if (hras == NULL)
+        return;
+    hras->span_buffer = buffer;
+}
+
+void raster_api_set_text_rectangle_callback(struct RasterHandler *hras, font_draw_rectangle_callback draw_text_rectangle) {
+    if (hras == NULL)
+        return;
+    hras->draw_text_rectangle = draw_text_rectangle;
+}
+
+void raster_api_set_opaque_text(struct RasterHandler *hras, bool enable) {
+    if (hras == NULL)
+        return;
+    hras->opaque_text = enable;
+}
+
+void raster_api_set_glyph_cache(struct RasterHandler *hras, struct FontGlyphCache *cache) {
+    if (hras == NULL)
+        return;
+    hras->glyph_cache = cache;
 }
 
 void raster_api_render(struct RasterHandler *hras) {
     // Do not clear full screen for max optimization (less time spent)
-    if (RASTER_PARTIAL == 0)
+    if (RASTER_PARTIAL == 0 && hras->clear_screen != NULL)
+        hras->clear_screen();
+
+    if (hras->queue != NULL)
+        raster_api_queue_drain(hras, hras->queue);
+
+    hras->damage_count = 0;
+    for (uint16_t i = 0; i < hras->size; i++) {
+        struct RasterBox *box = &hras->interface[i];
+        if (RASTER_PARTIAL != 0 && !box->updated)
+            continue;
+        if (prv_box_occluded(hras, i, &box->rect)) {
+            prv_box_hide(box);
+            continue;
+        }
+        prv_draw_text_box(hras, box);
+        if (RASTER_PARTIAL != 0)
+            prv_mark_boxes_above(hras, i);
+    }
+}
+
+/*!
+ * \brief Draws the part of a box inside a region
+ *
+ * \details Only reads the box and its label, so different regions can be
+ *     drawn at the same time.
+ *
+ * \param[in] hras Pointer to the RasterHandler struct holding the callbacks
+ * \param[in] index Position of the box in the interface
+ * \param[in] region The area of the screen to draw
+ */
+static void prv_draw_box_region(const struct RasterHandler *hras, uint16_t index, const struct RasterRect *region) {
+    const struct RasterBox *box = &hras->interface[index];
+    struct RasterRect rect = box->rect;
+    if (!prv_rect_clip(&rect, region) || prv_box_occluded(hras, index, &rect))
+        return;
+    hras->draw_rectangle(rect.x, rect.y, rect.w, rect.h, box->color);
+
+    const struct RasterLabel *label = box->label;
+    if (label == NULL)
+        return;
+
+    // Text is clipped to the part of the box inside the region
+    struct FontClip clip = { rect.x, rect.y, rect.w, rect.h };
+    uint32_t palette[FONT_PALETTE_SIZE];
+    struct FontTarget target = prv_text_target(hras, box, &clip, palette);
+    char buf[MAX_BUFFER_SIZE];
+    raster_api_format_label(label, buf, sizeof(buf));
+    uint16_t x = box->rect.x + label->pos.x;
+    uint16_t y = box->rect.y + label->pos.y;
+
+    // The cached layout is only read, it still describes the last full render
+    const struct RasterLabelCache *cache = &label->cache;
+    if (cache->valid && cache->layout.font == label->font && cache->layout.size == label->size && strcmp(buf, cache->text) == 0) {
+        struct FontLayout layout = cache->layout;
+        layout.glyphs = (struct FontLayoutGlyph *)cache->glyphs;
+        font_api_draw_layout(x, y, label->align, &layout, label->color, &target);
+    } else {
+        font_api_draw_target(x, y, label->align, label->font, buf, label->color, label->size, &target);
+    }
+}
+
+void raster_api_render_region(struct RasterHandler *hras, const struct RasterRect *region) {
+    if (hras == NULL || region == NULL)
+        return;
+
+    // With a grid only the boxes binned in the cells of the region are visited
+    if (hras->grid != NULL && hras->grid->valid) {
+        uint16_t positions[REGION_QUERY_SIZE];
+        uint16_t count = raster_api_query_rect(hras, region, positions, REGION_QUERY_SIZE);
+        if (count <= REGION_QUERY_SIZE) {
+            for (uint16_t i = 0; i < count; i++)
+                prv_draw_box_region(hras, positions[i], region);
+            return;
+        }
+    }
+
+    for (uint16_t i = 0; i < hras->size; i++)
+        prv_draw_box_region(hras, i, region);
+}
+
+/*!
+ * \brief Tiles of a frame shared by the render threads
+ */
+struct RasterTileJob {
+    struct RasterHandler *hras; /*!< Copy of the handler drawing the tiles, shared by the threads */
+    struct RasterRect screen;   /*!< Area covered by the tiles */
+    uint16_t tile_width;        /*!< Width of a tile */
+    uint16_t tile_height;       /*!< Height of a tile */
+    uint32_t cols;              /*!< Number of tiles in a row */
+    uint32_t count;             /*!< Total number of tiles */
+    uint32_t next;              /*!< Next tile to render, taken atomically */
+};
+
+/*!
+ * \brief Takes the next tile of a job
+ *
+ * \param[in,out] job Pointer to the RasterTileJob struct
+ *
+ * \return uint32_t Index of the tile, past the last tile when none is left
+ */
+static uint32_t prv_next_tile(struct RasterTileJob *job) {
+#if RASTER_THREADS > 1
+    return __atomic_fetch_add(&job->next, 1, __ATOMIC_RELAXED);
+#else
+    return job->next++;
+#endif
+}
+
+/*!
+ * \brief Checks if an updated box overlaps a tile
+ *
+ * \details The damage list of the frame already covers every updated box,
+ *     in at most RASTER_MAX_DAMAGE_RECTS rectangles, so the cost of a tile
+ *     does not grow with the number of boxes.
+ *
+ * \param[in] hras Pointer to the RasterHandler struct to use
+ * \param[in] tile The area of the tile
+ *
+ * \return bool
+ *     - true if the tile has to be rendered
+ *     - false if it did not change since the last render
+ */
+static bool prv_tile_dirty(const struct RasterHandler *hras, const struct RasterRect *tile) {
+    for (uint16_t i = 0; i < hras->damage_count; i++) {
+        if (prv_rect_overlaps(&hras->damage[i], tile))
+            return true;
+    }
+    return false;
+}
+
+/*!
+ * \brief Renders tiles until every tile of the job has been taken
+ *
+ * \details Tiles are taken one at a time from a shared counter, so faster
+ *     threads render more tiles. Tiles are disjoint, so threads never write
+ *     the same pixel.
+ *
+ * \param[in,out] job Pointer to the RasterTileJob struct
+ */
+static void prv_render_tiles(struct RasterTileJob *job) {
+    uint32_t tile;
+    while ((tile = prv_next_tile(job)) < job->count) {
+        struct RasterRect rect = {
+            (uint16_t)(job->screen.x + (tile % job->cols) * job->tile_width),
+            (uint16_t)(job->screen.y + (tile / job->cols) * job->tile_height),
+            job->tile_width,
+            job->tile_height
+        };
+        if (!prv_rect_clip(&rect, &job->screen))
+            continue;
+        if (RASTER_PARTIAL != 0 && !prv_tile_dirty(job->hras, &rect))
+            continue;
+        raster_api_render_region(job->hras, &rect);
+    }
+}
+
+#if RASTER_THREADS > 1
+/*!
+ * \brief Main loop of a worker thread
+ *
+ * \details Waits for the next frame, draws its tiles with the other threads
+ *     and signals the frame as done when it is the last worker to finish.
+ *
+ * \param[in,out] arg Pointer to the RasterWorkers struct
+ *
+ * \return void* Always NULL
+ */
+static void *prv_worker_main(void *arg) {
+    struct RasterWorkers *workers = arg;
+    uint32_t frame = 0;
+    pthread_mutex_lock(&workers->lock);
+    for (;;) {
+        while (!workers->stop && workers->frame == frame)
+            pthread_cond_wait(&workers->start, &workers->lock);
+        if (workers->stop)
+            break;
+        frame = workers->frame;
+        struct RasterTileJob *job = workers->job;
+        pthread_mutex_unlock(&workers->lock);
+
+        prv_render_tiles(job);
+
+        pthread_mutex_lock(&workers->lock);
+        if (--workers->busy == 0)
+            pthread_cond_signal(&workers->done);
+    }
+    pthread_mutex_unlock(&workers->lock);
+    return NULL;
+}
+
+/*!
+ * \brief Draws the tiles of a job with the workers and the calling thread
+ *
+ * \details Returns once every worker is done, so the job can live on the
+ *     stack of the caller.
+ *
+ * \param[in,out] workers Pointer to the RasterWorkers struct
+ * \param[in,out] job Pointer to the RasterTileJob struct
+ */
+static void prv_workers_run(struct RasterWorkers *workers, struct RasterTileJob *job) {
+    pthread_mutex_lock(&workers->lock);
+    workers->job = job;
+    workers->busy = workers->count;
+    workers->frame++;
+    pthread_cond_broadcast(&workers->start);
+    pthread_mutex_unlock(&workers->lock);
+
+    prv_render_tiles(job);
+
+    pthread_mutex_lock(&workers->lock);
+    while (workers->busy > 0)
+        pthread_cond_wait(&workers->done, &workers->lock);
+    workers->job = NULL;
+    pthread_mutex_unlock(&workers->lock);
+}
+#endif
+
+void raster_api_render_parallel(struct RasterHandler *hras, const struct RasterRect *screen, uint16_t tile_width, uint16_t tile_height) {
+    if (hras == NULL || screen == NULL || tile_width == 0 || tile_height == 0)
+        return;
+
+    if (RASTER_PARTIAL == 0 && hras->clear_screen != NULL)
         hras->clear_screen();
 
-    for (int i = 0; i < hras->size; i++) {
-        prv_draw_text_box(&hras->interface[i], hras->draw_rectangle, hras->draw_line);
+    if (hras->queue != NULL)
+        raster_api_queue_drain(hras, hras->queue);
+
+    // Layouts are computed before the threads start, which only read them
+    hras->damage_count = 0;
+    for (uint16_t i = 0; i < hras->size; i++) {
+        struct RasterBox *box = &hras->interface[i];
+        if (RASTER_PARTIAL != 0 && !box->updated)
+            continue;
+        if (prv_box_occluded(hras, i, &box->rect)) {
+            prv_box_hide(box);
+            continue;
+        }
+        if (box->label != NULL) {
+            char buf[MAX_BUFFER_SIZE];
+            raster_api_format_label(box->label, buf, sizeof(buf));
+            prv_label_prepare(box, buf);
+        }
+        struct RasterRect rect = box->rect;
+        if (prv_rect_clip(&rect, screen))
+            prv_damage_add(hras, rect);
     }
+
+    // Tiles draw through a copy, as span buffers and glyph caches cannot be shared
+    struct RasterHandler shared = *hras;
+    shared.span_buffer = NULL;
+    shared.glyph_cache = NULL;
+    struct RasterTileJob job = {
+        .hras = &shared,
+        .screen = *screen,
+        .tile_width = tile_width,
+        .tile_height = tile_height,
+        .cols = (screen->w + tile_width - 1u) / tile_width,
+        .count = ((screen->w + tile_width - 1u) / tile_width) * ((screen->h + tile_height - 1u) / tile_height),
+        .next = 0
+    };
+
+#if RASTER_THREADS > 1
+    if (hras->workers != NULL && hras->workers->count > 0)
+        prv_workers_run(hras->workers, &job);
+    else
+        prv_render_tiles(&job);
+#else
+    prv_render_tiles(&job);
+#endif
+
+    for (uint16_t i = 0; i < hras->size; i++)
+        hras->interface[i].updated = false;
+}
+
+bool raster_api_workers_init(struct RasterWorkers *workers) {
+    if (workers == NULL)
+        return false;
+    workers->count = 0;
+#if RASTER_THREADS > 1
+    workers->job = NULL;
+    workers->frame = 0;
+    workers->busy = 0;
+    workers->stop = false;
+    if (pthread_mutex_init(&workers->lock, NULL) != 0)
+        return false;
+    if (pthread_cond_init(&workers->start, NULL) != 0) {
+        pthread_mutex_destroy(&workers->lock);
+        return false;
+    }
+    if (pthread_cond_init(&workers->done, NULL) != 0) {
+        pthread_cond_destroy(&workers->start);
+        pthread_mutex_destroy(&workers->lock);
+        return false;
+    }
+    for (uint16_t i = 0; i < RASTER_THREADS - 1; i++) {
+        if (pthread_create(&workers->threads[workers->count], NULL, prv_worker_main, workers) == 0)
+            workers->count++;
+    }
+#endif
+    return true;
+}
+
+void raster_api_workers_destroy(struct RasterWorkers *workers) {
+    if (workers == NULL)
+        return;
+#if RASTER_THREADS > 1
+    pthread_mutex_lock(&workers->lock);
+    workers->stop = true;
+    pthread_cond_broadcast(&workers->start);
+    pthread_mutex_unlock(&workers->lock);
+    for (uint16_t i = 0; i < workers->count; i++)
+        pthread_join(workers->threads[i], NULL);
+    pthread_cond_destroy(&workers->done);
+    pthread_cond_destroy(&workers->start);
+    pthread_mutex_destroy(&workers->lock);
+#endif
+    workers->count = 0;
+}
+
+void raster_api_set_workers(struct RasterHandler *hras, struct RasterWorkers *workers) {
+    if (hras == NULL)
+        return;
+    hras->workers = workers;
+}
+
+bool raster_api_get_damage(const struct RasterHandler *hras, const struct RasterRect **rects, uint16_t *count) {
+    if (hras == NULL || rects == NULL || count == NULL)
+        return false;
+    *rects = hras->damage;
+    *count = hras->damage_count;
+    return RASTER_PARTIAL != 0;
 }
 
 struct RasterBox *raster_api_get_box(struct RasterBox *boxes, uint16_t num, uint16_t id) {
@@ -148,6 +1288,27 @@ struct RasterBox *raster_api_get_box(struct RasterBox *boxes, uint16_t num, uint
     return NULL;
 }
 
+struct RasterBox *raster_api_find_box(const struct RasterHandler *hras, uint16_t id) {
+    if (hras == NULL)
+        return NULL;
+    if (!hras->index_valid)
+        return raster_api_get_box(hras->interface, hras->size, id);
+
+    uint16_t low = 0;
+    uint16_t high = hras->size;
+    while (low < high) {
+        uint16_t mid = low + (high - low) / 2;
+        struct RasterBox *box = &hras->interface[hras->index[mid]];
+        if (box->id == id)
+            return box;
+        else if (box->id < id)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+    return NULL;
+}
+
 void raster_api_create_label(struct RasterLabel *label, union RasterLabelData data, enum RasterLabelDataType type, union RasterLabelFormat format, struct RasterCoords pos, enum FontName font, uint16_t size, enum FontAlign align, struct Color color) {
     if (label == NULL)
         return;
@@ -159,18 +1320,212 @@ void raster_api_create_label(struct RasterLabel *label, union RasterLabelData da
     label->size = size;
     label->align = align;
     label->color = color;
+    label->cache.text[0] = '\0';
+    label->cache.valid = false;
 }
 
 void raster_api_set_label_data(struct RasterBox *box, union RasterLabelData data) {
     if (box == NULL || box->label == NULL)
         return;
     box->label->data = data;
+    if (prv_label_changed(box->label))
+        box->updated = true;
+}
+
+void raster_api_grid_init(struct RasterGrid *grid, uint16_t *cells, uint16_t cell_capacity, uint16_t *entries, uint16_t entry_capacity, uint8_t cell_shift) {
+    if (grid == NULL)
+        return;
+    grid->cells = cells;
+    grid->cell_capacity = cell_capacity;
+    grid->entries = entries;
+    grid->entry_capacity = entry_capacity;
+    grid->cell_shift = cell_shift;
+    grid->cols = 0;
+    grid->rows = 0;
+    grid->valid = false;
+}
+
+void raster_api_set_grid(struct RasterHandler *hras, struct RasterGrid *grid) {
+    if (hras == NULL)
+        return;
+    hras->grid = grid;
+    prv_build_grid(hras);
+}
+
+uint16_t raster_api_query_rect(const struct RasterHandler *hras, const struct RasterRect *rect, uint16_t *positions, uint16_t capacity) {
+    if (hras == NULL || rect == NULL || (positions == NULL && capacity != 0))
+        return 0;
+
+    uint16_t count = 0;
+    const struct RasterGrid *grid = hras->grid;
+    if (grid != NULL && grid->valid) {
+        uint16_t range[4];
+        if (!prv_grid_range(grid, rect, range))
+            return 0;
+        for (uint16_t cy = range[1]; cy <= range[3]; cy++) {
+            for (uint16_t cx = range[0]; cx <= range[2]; cx++) {
+                uint16_t cell = cy * grid->cols + cx;
+                for (uint16_t e = grid->cells[cell]; e < grid->cells[cell + 1]; e++) {
+                    const struct RasterRect *r = &hras->interface[grid->entries[e]].rect;
+                    if (!prv_rect_overlaps(r, rect))
+                        continue;
+                    // Report a box only from the cell holding the corner of the overlap
+                    uint16_t ix = r->x > rect->x ? r->x : rect->x;
+                    uint16_t iy = r->y > rect->y ? r->y : rect->y;
+                    if ((ix >> grid->cell_shift) != cx || (iy >> grid->cell_shift) != cy)
+                        continue;
+                    if (count < capacity)
+                        positions[count] = grid->entries[e];
+                    count++;
+                }
+            }
+        }
+
+        uint16_t stored = count < capacity ? count : capacity;
+        for (uint16_t i = 1; i < stored; i++) {
+            uint16_t position = positions[i];
+            uint16_t j = i;
+            while (j > 0 && positions[j - 1] > position) {
+                positions[j] = positions[j - 1];
+                j--;
+            }
+            positions[j] = position;
+        }
+        return count;
+    }
+
+    for (uint16_t i = 0; i < hras->size; i++) {
+        if (!prv_rect_overlaps(&hras->interface[i].rect, rect))
+            continue;
+        if (count < capacity)
+            positions[count] = i;
+        count++;
+    }
+    return count;
+}
+
+struct RasterBox *raster_api_box_at(const struct RasterHandler *hras, uint16_t x, uint16_t y) {
+    if (hras == NULL)
+        return NULL;
+
+    struct RasterRect point = { x, y, 1, 1 };
+    const struct RasterGrid *grid = hras->grid;
+    if (grid != NULL && grid->valid) {
+        uint16_t range[4];
+        if (!prv_grid_range(grid, &point, range))
+            return NULL;
+        uint16_t cell = range[1] * grid->cols + range[0];
+        for (uint16_t e = grid->cells[cell + 1]; e > grid->cells[cell]; e--) {
+            struct RasterBox *box = &hras->interface[grid->entries[e - 1]];
+            if (prv_rect_overlaps(&box->rect, &point))
+                return box;
+        }
+        return NULL;
+    }
+
+    for (uint16_t i = hras->size; i-- > 0;) {
+        if (prv_rect_overlaps(&hras->interface[i].rect, &point))
+            return &hras->interface[i];
+    }
+    return NULL;
+}
+
+uint16_t raster_api_apply_updates(struct RasterHandler *hras, struct RasterUpdate *updates, uint16_t count) {
+    if (hras == NULL || updates == NULL)
+        return 0;
+
+    // Stable insertion sort: bursts are usually small and partially ordered
+    for (uint16_t i = 1; i < count; i++) {
+        struct RasterUpdate update = updates[i];
+        uint16_t j = i;
+        while (j > 0 && updates[j - 1].id > update.id) {
+            updates[j] = updates[j - 1];
+            j--;
+        }
+        updates[j] = update;
+    }
+
+    uint16_t applied = 0;
+    uint16_t position = 0;
+    for (uint16_t i = 0; i < count; i++) {
+        // Only the last value of every id is applied
+        if (i + 1 < count && updates[i + 1].id == updates[i].id)
+            continue;
+
+        struct RasterBox *box = NULL;
+        if (hras->index_valid) {
+            while (position < hras->size && hras->interface[hras->index[position]].id < updates[i].id)
+                position++;
+            if (position < hras->size && hras->interface[hras->index[position]].id == updates[i].id)
+                box = &hras->interface[hras->index[position]];
+        } else {
+            box = raster_api_get_box(hras->interface, hras->size, updates[i].id);
+        }
+
+        if (box != NULL && box->label != NULL) {
+            raster_api_set_label_data(box, updates[i].data);
+            applied++;
+        }
+    }
+    return applied;
+}
+
+bool raster_api_queue_init(struct RasterUpdateQueue *queue, struct RasterUpdate *storage, uint16_t capacity) {
+    if (queue == NULL || storage == NULL || capacity == 0 || (capacity & (capacity - 1)) != 0)
+        return false;
+    queue->updates = storage;
+    queue->mask = capacity - 1;
+    queue->head = 0;
+    queue->tail = 0;
+    return true;
+}
+
+bool raster_api_queue_push(struct RasterUpdateQueue *queue, uint16_t id, union RasterLabelData data) {
+    if (queue == NULL)
+        return false;
+    uint32_t head = __atomic_load_n(&queue->head, __ATOMIC_RELAXED);
+    uint32_t tail = __atomic_load_n(&queue->tail, __ATOMIC_ACQUIRE);
+    if (head - tail > queue->mask)
+        return false;
+
+    queue->updates[head & queue->mask] = (struct RasterUpdate){ id, data };
+    // Publish the slot only after it is fully written
+    __atomic_store_n(&queue->head, head + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+uint16_t raster_api_queue_drain(struct RasterHandler *hras, struct RasterUpdateQueue *queue) {
+    if (hras == NULL || queue == NULL)
+        return 0;
+
+    // Only the updates visible now are drained, later ones wait for the next frame
+    uint32_t head = __atomic_load_n(&queue->head, __ATOMIC_ACQUIRE);
+    uint32_t tail = __atomic_load_n(&queue->tail, __ATOMIC_RELAXED);
+    uint16_t applied = 0;
+    struct RasterUpdate batch[RASTER_QUEUE_DRAIN_BATCH];
+    while (tail != head) {
+        uint16_t count = 0;
+        while (tail != head && count < RASTER_QUEUE_DRAIN_BATCH)
+            batch[count++] = queue->updates[tail++ & queue->mask];
+        // Give the slots back before applying so the producer is not stalled
+        __atomic_store_n(&queue->tail, tail, __ATOMIC_RELEASE);
+        applied += raster_api_apply_updates(hras, batch, count);
+    }
+    return applied;
+}
+
+void raster_api_set_update_queue(struct RasterHandler *hras, struct RasterUpdateQueue *queue) {
+    if (hras == NULL)
+        return;
+    hras->queue = queue;
 }
 
 void raster_api_set_label_format(struct RasterBox *box, union RasterLabelFormat format) {
     if (box == NULL || box->label == NULL)
         return;
     box->label->format = format;
+    if (prv_label_changed(box->label))
+        box->updated = true;
 }
 
 struct RasterIntFormat raster_api_int_format(bool is_unsigned) {
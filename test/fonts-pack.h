@@ -0,0 +1,394 @@
+/**
+ * @file fonts-pack.h
+ * @brief Font pack of test/pack.json, as written by the generator
+ *
+ * Regenerate with `python3 tools/generator.py --json test/pack.json --pack fonts.pack`
+ * and dump fonts.pack here. The fonts match konexy_soft and konexy_sdf of
+ * test/fonts.json, so they must draw the same pixels.
+ */
+
+#ifndef TEST_FONTS_PACK_H
+#define TEST_FONTS_PACK_H
+
+#include <stdint.h>
+
+static const uint8_t fonts_pack[] __attribute__((aligned(4))) = {
+    0x4c, 0x52, 0x46, 0x50, 0x01, 0x00, 0x02, 0x00, 0x7c, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x73, 0x6f, 0x66, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3c, 0x00, 0x00, 0x01, 0x00, 0xff, 0x02, 0x00, 0x50, 0x00, 0x00, 0x00, 0xc4, 0x0f, 0x00, 0x00,
+    0x64, 0x69, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0x00, 0x01, 0x01, 0x33, 0x80, 0x02, 0x00, 0xd4, 0x0f, 0x00, 0x00, 0x6c, 0x17, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xed, 0x06, 0x42, 0x00, 0x47, 0x00, 0x00, 0x00,
+    0x57, 0x00, 0x00, 0x00, 0xed, 0x06, 0x00, 0x00, 0x65, 0x07, 0x57, 0x00, 0x47, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x01, 0x27, 0x07, 0x01, 0x2d, 0x08, 0x02, 0x05, 0x01, 0x42,
+    0x07, 0x01, 0x02, 0x2b, 0x01, 0x42, 0x08, 0x01, 0x01, 0x03, 0x01, 0x4b, 0x01, 0x07, 0x42, 0x01,
+    0x01, 0x02, 0x29, 0x01, 0x4b, 0x01, 0x08, 0x41, 0x01, 0x01, 0x01, 0x02, 0x01, 0x4b, 0x01, 0x01,
+    0xed, 0x05, 0x01, 0xb4, 0x01, 0x01, 0x20, 0x01, 0x27, 0x14, 0x01, 0x01, 0xbd, 0x01, 0x01, 0xeb,
+    0x06, 0x01, 0x41, 0x01, 0x01, 0x01, 0x02, 0x01, 0x4b, 0x01, 0x01, 0xef, 0x01, 0x05, 0xdb, 0x01,
+    0x01, 0x42, 0x01, 0x01, 0x02, 0x26, 0x01, 0x4b, 0x01, 0x01, 0xef, 0x01, 0x05, 0xeb, 0x01, 0x01,
+    0x41, 0x01, 0x01, 0x01, 0x02, 0x01, 0x4b, 0x01, 0x01, 0xef, 0x01, 0x06, 0xdb, 0x01, 0x01, 0x41,
+    0x01, 0x01, 0x02, 0x24, 0x01, 0x4b, 0x01, 0x01, 0xdf, 0x01, 0x06, 0xeb, 0x01, 0x01, 0x41, 0x01,
+    0x01, 0x01, 0x02, 0x01, 0x4b, 0x01, 0x01, 0xef, 0x01, 0x06, 0xeb, 0x01, 0x01, 0x42, 0x01, 0x01,
+    0x01, 0x23, 0x01, 0x4b, 0x01, 0x01, 0xdf, 0x01, 0x07, 0xeb, 0x01, 0x01, 0x41, 0x01, 0x01, 0x01,
+    0x02, 0x01, 0x4b, 0x01, 0x01, 0xef, 0x01, 0x07, 0xdb, 0x01, 0x01, 0x42, 0x01, 0x01, 0x02, 0x22,
+    0x01, 0x4b, 0x01, 0x01, 0xef, 0x01, 0x07, 0xeb, 0x01, 0x01, 0x41, 0x01, 0x01, 0x01, 0x02, 0x01,
+    0x4b, 0x01, 0x01, 0xef, 0x01, 0x08, 0xdb, 0x01, 0x01, 0x42, 0x01, 0x01, 0x02, 0x20, 0x01, 0x4b,
+    0x01, 0x01, 0xdf, 0x01, 0x08, 0xeb, 0x01, 0x01, 0x41, 0x01, 0x01, 0x01, 0x02, 0x01, 0x4b, 0x01,
+    0x01, 0xef, 0x01, 0x09, 0xdb, 0x01, 0x01, 0x41, 0x01, 0x01, 0x02, 0x1e, 0x01, 0x4b, 0x01, 0x01,
+    0xdf, 0x01, 0x09, 0xeb, 0x01, 0x01, 0x41, 0x01, 0x01, 0x01, 0x02, 0x01, 0x4b, 0x01, 0x01, 0xef,
+    0x01, 0x09, 0xeb, 0x01, 0x01, 0x42, 0x01, 0x01, 0x01, 0x1d, 0x01, 0x4b, 0x01, 0x01, 0xdf, 0x01,
+    0x0a, 0xeb, 0x01, 0x01, 0x41, 0x01, 0x01, 0x01, 0x02, 0x01, 0x4b, 0x01, 0x01, 0xef, 0x01, 0x0a,
+    0xdb, 0x01, 0x01, 0x42, 0x01, 0x01, 0x02, 0x1c, 0x01, 0x4b, 0x01, 0x01, 0xef, 0x01, 0x0a, 0xeb,
+    0x01, 0x01, 0x41, 0x01, 0x01, 0x01, 0x02, 0x01, 0x4b, 0x01, 0x01, 0xef, 0x01, 0x0b, 0xdb, 0x01,
+    0x01, 0x42, 0x01, 0x01, 0x02, 0x1a, 0x01, 0x4b, 0x01, 0x01, 0xdf, 0x01, 0x0b, 0xeb, 0x01, 0x01,
+    0x41, 0x01, 0x01, 0x01, 0x02, 0x01, 0x4b, 0x01, 0x01, 0xef, 0x01, 0x0c, 0xdb, 0x01, 0x01, 0x41,
+    0x01, 0x01, 0x02, 0x18, 0x01, 0x4b, 0x01, 0x01, 0xdf, 0x01, 0x0c, 0xeb, 0x01, 0x01, 0x41, 0x01,
+    0x01, 0x01, 0x02, 0x01, 0x4b, 0x01, 0x01, 0xef, 0x01, 0x06, 0xef, 0x01, 0x05, 0xeb, 0x01, 0x01,
+    0x42, 0x01, 0x01, 0x01, 0x17, 0x01, 0x4b, 0x01, 0x01, 0xdf, 0x01, 0x06, 0xef, 0x01, 0x06, 0xeb,
+    0x01, 0x01, 0x41, 0x01, 0x01, 0x01, 0x02, 0x01, 0x4b, 0x01, 0x01, 0xef, 0x01, 0x05, 0xdb, 0x01,
+    0x01, 0xdf, 0x01, 0x05, 0xdb, 0x01, 0x01, 0x42, 0x01, 0x01, 0x02, 0x16, 0x01, 0x4b, 0x01, 0x01,
+    0xef, 0x01, 0x05, 0xdb, 0x01, 0x01, 0xdf, 0x01, 0x05, 0xeb, 0x01, 0x01, 0x41, 0x01, 0x01, 0x01,
+    0x02, 0x01, 0x4b, 0x01, 0x01, 0xef, 0x01, 0x04, 0xeb, 0x01, 0x01, 0x4b, 0x01, 0x01, 0xef, 0x01,
+    0x05, 0xdb, 0x01, 0x01, 0x42, 0x01, 0x01, 0x02, 0x14, 0x01, 0x4b, 0x01, 0x01, 0xdf, 0x01, 0x05,
+    0xdb, 0x01, 0x01, 0x4b, 0x01, 0x01, 0xef, 0x01, 0x04, 0xeb, 0x01, 0x01, 0x41, 0x01, 0x01, 0x01,
+    0x02, 0x01, 0x4b, 0x01, 0x01, 0xef, 0x01, 0x04, 0xeb, 0x01, 0x01, 0x4b, 0x01, 0x01, 0xdf, 0x01,
+    0x06, 0xdb, 0x01, 0x01, 0x41, 0x01, 0x01, 0x02, 0x12, 0x01, 0x4b, 0x01, 0x01, 0xdf, 0x01, 0x05,
+    0xeb, 0x01, 0x01, 0x4b, 0x02, 0x01, 0xef, 0x01, 0x04, 0xeb, 0x01, 0x01, 0x41, 0x01, 0x01, 0x01,
+    0x02, 0x01, 0x4b, 0x01, 0x01, 0xef, 0x01, 0x04, 0xeb, 0x01, 0x01, 0x4b, 0x02, 0x01, 0xdf, 0x01,
+    0x05, 0xeb, 0x01, 0x01, 0x42, 0x01, 0x01, 0x01, 0x11, 0x01, 0x4b, 0x01, 0x01, 0xdf, 0x01, 0x06,
+    0xdb, 0x01, 0x01, 0x4b, 0x02, 0x01, 0xef, 0x01, 0x04, 0xeb, 0x01, 0x01, 0x41, 0x01, 0x01, 0x01,
+    0x02, 0x01, 0x4b, 0x01, 0x01, 0xef, 0x01, 0x04, 0xeb, 0x01, 0x01, 0x42, 0x01, 0x01, 0x4b, 0x01,
+    0x01, 0xdf, 0x01, 0x05, 0xdb, 0x01, 0x01, 0x42, 0x01, 0x01, 0x02, 0x10, 0x01, 0x4b, 0x01, 0x01,
+    0xef, 0x01, 0x05, 0xdb, 0x01, 0x01, 0x42, 0x01, 0x01, 0x4b, 0x01, 0x01, 0xef, 0x01, 0x04, 0xeb,
+    0x01, 0x01, 0x41, 0x01, 0x01, 0x01, 0x02, 0x01, 0x4b, 0x01, 0x01, 0xef, 0x01, 0x04, 0xeb, 0x01,
+    0x01, 0x41, 0x01, 0x01, 0x24, 0x01, 0x01, 0xbe, 0x01, 0x01, 0xfd, 0x05, 0x01, 0xb4, 0x01, 0x01,
+    0x10, 0x01, 0x0e, 0x24, 0x01, 0x01, 0xbd, 0x01, 0x01, 0xfd, 0x05, 0x01, 0xb4, 0x01, 0x01, 0x21,
+    0x01, 0x01, 0x4b, 0x01, 0x01, 0xef, 0x01, 0x04, 0xeb, 0x01, 0x01, 0x41, 0x01, 0x01, 0x01, 0x02,
+    0x01, 0x4b, 0x01, 0x01, 0xef, 0x01, 0x04, 0xeb, 0x01, 0x01, 0x41, 0x01, 0x02, 0x4b, 0x01, 0x01,
+    0xdf, 0x01, 0x05, 0xeb, 0x01, 0x01, 0x42, 0x01, 0x01, 0x02, 0x0d, 0x01, 0x4b, 0x01, 0x01, 0xdf,
+    0x01, 0x05, 0xeb, 0x01, 0x01, 0x42, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4b, 0x01, 0x01, 0xef, 0x01,
+    0x04, 0xeb, 0x01, 0x01, 0x41, 0x01, 0x01, 0x01, 0x02, 0x01, 0x4b, 0x01, 0x01, 0xef, 0x01, 0x04,
+    0xeb, 0x01, 0x01, 0x41, 0x01, 0x01, 0x02, 0x01, 0x01, 0x4b, 0x01, 0x01, 0xdf, 0x01, 0x05, 0xdb,
+    0x01, 0x01, 0x42, 0x01, 0x01, 0x01, 0x0b, 0x01, 0x4b, 0x01, 0x01, 0xdf, 0x01, 0x06, 0xdb, 0x01,
+    0x01, 0x41, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4b, 0x01, 0x01, 0xef, 0x01, 0x04, 0xeb, 0x01, 0x01,
+    0x41, 0x01, 0x01, 0x01, 0x02, 0x01, 0x4b, 0x01, 0x01, 0xef, 0x01, 0x04, 0xeb, 0x01, 0x01, 0x41,
+    0x01, 0x01, 0x02, 0x02, 0x01, 0x4b, 0x01, 0x01, 0xdf, 0x01, 0x05, 0xdb, 0x01, 0x01, 0x42, 0x01,
+    0x01, 0x02, 0x0a, 0x01, 0x4b, 0x01, 0x01, 0xef, 0x01, 0x05, 0xdb, 0x01, 0x01, 0x42, 0x01, 0x01,
+    0x01, 0x02, 0x01, 0x4b, 0x01, 0x01, 0xef, 0x01, 0x04, 0xeb, 0x01, 0x01, 0x41, 0x01, 0x01, 0x01,
+    0x02, 0x01, 0x4b, 0x01, 0x01, 0xef, 0x01, 0x04, 0xeb, 0x01, 0x01, 0x41, 0x01, 0x01, 0x02, 0x03,
+    0x01, 0x4b, 0x01, 0x01, 0xef, 0x01, 0x05, 0xdb, 0x01, 0x01, 0x41, 0x01, 0x01, 0x02, 0x08, 0x01,
+    0x4b, 0x01, 0x01, 0xdf, 0x01, 0x05, 0xdb, 0x01, 0x01, 0x42, 0x01, 0x01, 0x01, 0x03, 0x01, 0x4b,
+    0x01, 0x01, 0xef, 0x01, 0x04, 0xeb, 0x01, 0x01, 0x41, 0x01, 0x01, 0x01, 0x02, 0x01, 0x4b, 0x01,
+    0x01, 0xef, 0x01, 0x04, 0xeb, 0x01, 0x01, 0x41, 0x01, 0x01, 0x01, 0x03, 0x01, 0x4b, 0x01, 0x01,
+    0xdf, 0x01, 0x05, 0xeb, 0x01, 0x01, 0x42, 0x01, 0x01, 0x01, 0x07, 0x01, 0x4b, 0x01, 0x01, 0xdf,
+    0x01, 0x05, 0xeb, 0x01, 0x01, 0x42, 0x01, 0x01, 0x01, 0x04, 0x01, 0x4b, 0x01, 0x01, 0xef, 0x01,
+    0x04, 0xeb, 0x01, 0x01, 0x41, 0x01, 0x01, 0x01, 0x02, 0x01, 0x4b, 0x01, 0x01, 0xef, 0x01, 0x04,
+    0xeb, 0x01, 0x01, 0x41, 0x01, 0x01, 0x02, 0x04, 0x01, 0x4b, 0x01, 0x01, 0xdf, 0x01, 0x05, 0xdb,
+    0x01, 0x01, 0x42, 0x01, 0x01, 0x02, 0x06, 0x01, 0x4b, 0x01, 0x01, 0xef, 0x01, 0x05, 0xdb, 0x01,
+    0x01, 0x41, 0x01, 0x01, 0x01, 0x04, 0x01, 0x4b, 0x01, 0x01, 0xef, 0x01, 0x04, 0xeb, 0x01, 0x01,
+    0x41, 0x01, 0x01, 0x01, 0x02, 0x01, 0x4b, 0x01, 0x01, 0xef, 0x01, 0x04, 0xeb, 0x01, 0x01, 0x41,
+    0x01, 0x01, 0x02, 0x05, 0x01, 0x4b, 0x01, 0x01, 0xef, 0x01, 0x05, 0xdb, 0x01, 0x01, 0x42, 0x01,
+    0x01, 0x02, 0x04, 0x01, 0x4b, 0x01, 0x01, 0xdf, 0x01, 0x05, 0xdb, 0x01, 0x01, 0x42, 0x01, 0x01,
+    0x01, 0x05, 0x01, 0x4b, 0x01, 0x01, 0xef, 0x01, 0x04, 0xeb, 0x01, 0x01, 0x41, 0x01, 0x01, 0x01,
+    0x02, 0x01, 0x4b, 0x01, 0x01, 0xef, 0x01, 0x04, 0xeb, 0x01, 0x01, 0x41, 0x01, 0x01, 0x01, 0x05,
+    0x01, 0x4b, 0x01, 0x01, 0xdf, 0x01, 0x06, 0xdb, 0x01, 0x01, 0x41, 0x01, 0x01, 0x02, 0x02, 0x01,
+    0x4b, 0x01, 0x01, 0xdf, 0x01, 0x05, 0xeb, 0x01, 0x01, 0x42, 0x01, 0x01, 0x01, 0x06, 0x01, 0x4b,
+    0x01, 0x01, 0xef, 0x01, 0x04, 0xeb, 0x01, 0x01, 0x41, 0x01, 0x01, 0x01, 0x02, 0x01, 0x4b, 0x01,
+    0x01, 0xef, 0x01, 0x04, 0xeb, 0x01, 0x01, 0x41, 0x01, 0x01, 0x02, 0x06, 0x01, 0x4b, 0x01, 0x01,
+    0xdf, 0x01, 0x05, 0xeb, 0x01, 0x01, 0x42, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4b, 0x01, 0x01, 0xdf,
+    0x01, 0x06, 0xdb, 0x01, 0x01, 0x41, 0x01, 0x01, 0x01, 0x06, 0x01, 0x4b, 0x01, 0x01, 0xef, 0x01,
+    0x04, 0xeb, 0x01, 0x01, 0x41, 0x01, 0x01, 0x01, 0x02, 0x01, 0x4b, 0x01, 0x01, 0xef, 0x01, 0x04,
+    0xeb, 0x01, 0x01, 0x41, 0x01, 0x01, 0x02, 0x07, 0x01, 0x4b, 0x01, 0x01, 0xdf, 0x01, 0x05, 0xdb,
+    0x01, 0x01, 0x42, 0x01, 0x02, 0x4b, 0x01, 0x01, 0xef, 0x01, 0x05, 0xdb, 0x01, 0x01, 0x42, 0x01,
+    0x01, 0x01, 0x07, 0x01, 0x4b, 0x01, 0x01, 0xef, 0x01, 0x04, 0xeb, 0x01, 0x01, 0x41, 0x01, 0x01,
+    0x01, 0x02, 0x01, 0x4b, 0x01, 0x01, 0xef, 0x01, 0x04, 0xeb, 0x01, 0x01, 0x41, 0x01, 0x01, 0x02,
+    0x08, 0x01, 0x4b, 0x01, 0x01, 0xef, 0x01, 0x05, 0xdb, 0x01, 0x01, 0x4b, 0x02, 0x01, 0xdf, 0x01,
+    0x05, 0xdb, 0x01, 0x01, 0x42, 0x01, 0x01, 0x01, 0x08, 0x01, 0x4b, 0x01, 0x01, 0xef, 0x01, 0x04,
+    0xeb, 0x01, 0x01, 0x41, 0x01, 0x01, 0x01, 0x02, 0x01, 0x4b, 0x01, 0x01, 0xef, 0x01, 0x04, 0xeb,
+    0x01, 0x01, 0x41, 0x01, 0x01, 0x01, 0x08, 0x01, 0x4b, 0x01, 0x01, 0xdf, 0x01, 0x06, 0xdb, 0x01,
+    0x02, 0xdf, 0x01, 0x05, 0xeb, 0x01, 0x01, 0x42, 0x01, 0x01, 0x01, 0x09, 0x01, 0x4b, 0x01, 0x01,
+    0xef, 0x01, 0x04, 0xeb, 0x01, 0x01, 0x41, 0x01, 0x01, 0x01, 0x02, 0x01, 0x4b, 0x01, 0x01, 0xef,
+    0x01, 0x04, 0xeb, 0x01, 0x01, 0x41, 0x01, 0x01, 0x02, 0x09, 0x01, 0x4b, 0x01, 0x01, 0xdf, 0x01,
+    0x06, 0xef, 0x02, 0x06, 0xdb, 0x01, 0x01, 0x41, 0x01, 0x01, 0x01, 0x09, 0x01, 0x4b, 0x01, 0x01,
+    0xef, 0x01, 0x04, 0xeb, 0x01, 0x01, 0x41, 0x01, 0x01, 0x01, 0x02, 0x01, 0x4b, 0x01, 0x01, 0xef,
+    0x01, 0x04, 0xeb, 0x01, 0x01, 0x41, 0x01, 0x01, 0x02, 0x0a, 0x01, 0x4b, 0x01, 0x01, 0xdf, 0x01,
+    0x0c, 0xdb, 0x01, 0x01, 0x42, 0x01, 0x01, 0x01, 0x0a, 0x01, 0x4b, 0x01, 0x01, 0xef, 0x01, 0x04,
+    0xeb, 0x01, 0x01, 0x41, 0x01, 0x01, 0x01, 0x02, 0x01, 0x4b, 0x01, 0x01, 0xef, 0x01, 0x04, 0xeb,
+    0x01, 0x01, 0x41, 0x01, 0x01, 0x02, 0x0b, 0x01, 0x4b, 0x01, 0x01, 0xef, 0x01, 0x0a, 0xdb, 0x01,
+    0x01, 0x42, 0x01, 0x01, 0x01, 0x0b, 0x01, 0x4b, 0x01, 0x01, 0xef, 0x01, 0x04, 0xeb, 0x01, 0x01,
+    0x41, 0x01, 0x01, 0x01, 0x02, 0x01, 0x4b, 0x01, 0x01, 0xef, 0x01, 0x04, 0xeb, 0x01, 0x01, 0x41,
+    0x01, 0x01, 0x01, 0x0b, 0x01, 0x4b, 0x01, 0x01, 0xdf, 0x01, 0x09, 0xeb, 0x01, 0x01, 0x42, 0x01,
+    0x01, 0x01, 0x0c, 0x01, 0x4b, 0x01, 0x01, 0xef, 0x01, 0x04, 0xeb, 0x01, 0x01, 0x41, 0x01, 0x01,
+    0x01, 0x02, 0x01, 0x4b, 0x01, 0x01, 0xef, 0x01, 0x04, 0xeb, 0x01, 0x01, 0x41, 0x01, 0x01, 0x02,
+    0x0c, 0x01, 0x4b, 0x01, 0x01, 0xdf, 0x01, 0x08, 0xdb, 0x01, 0x01, 0x41, 0x01, 0x01, 0x01, 0x0c,
+    0x01, 0x4b, 0x01, 0x01, 0xef, 0x01, 0x04, 0xeb, 0x01, 0x01, 0x41, 0x01, 0x01, 0x01, 0x02, 0x01,
+    0x4b, 0x01, 0x01, 0xef, 0x01, 0x04, 0xeb, 0x01, 0x01, 0x41, 0x01, 0x01, 0x02, 0x0d, 0x01, 0x4b,
+    0x01, 0x01, 0xef, 0x01, 0x06, 0xdb, 0x01, 0x01, 0x42, 0x01, 0x01, 0x01, 0x0d, 0x01, 0x4b, 0x01,
+    0x01, 0xef, 0x01, 0x04, 0xeb, 0x01, 0x01, 0x41, 0x01, 0x01, 0x01, 0x02, 0x01, 0x4b, 0x01, 0x01,
+    0xeb, 0x06, 0x01, 0x41, 0x01, 0x01, 0x01, 0x0d, 0x01, 0x4b, 0x01, 0x01, 0xde, 0x01, 0x05, 0xdb,
+    0x01, 0x01, 0x42, 0x01, 0x01, 0x01, 0x0e, 0x01, 0x4b, 0x01, 0x01, 0xeb, 0x06, 0x01, 0x41, 0x01,
+    0x01, 0x01, 0x02, 0x01, 0x4b, 0x01, 0x08, 0x41, 0x01, 0x01, 0x02, 0x0e, 0x01, 0x4b, 0x01, 0x07,
+    0x42, 0x01, 0x01, 0x01, 0x0f, 0x01, 0x4b, 0x01, 0x08, 0x41, 0x01, 0x01, 0x02, 0x03, 0x01, 0x42,
+    0x08, 0x01, 0x02, 0x10, 0x01, 0x42, 0x07, 0x01, 0x02, 0x11, 0x01, 0x42, 0x08, 0x01, 0x01, 0x05,
+    0x08, 0x01, 0x12, 0x07, 0x01, 0x13, 0x08, 0x00, 0xff, 0xff, 0x00, 0xff, 0x1e, 0x00, 0xff, 0xff,
+    0x00, 0xff, 0xff, 0x00, 0xff, 0x76, 0x10, 0x09, 0x1e, 0x10, 0x07, 0x1e, 0x10, 0x09, 0x01, 0x24,
+    0x01, 0x09, 0x20, 0x01, 0x1c, 0x24, 0x01, 0x07, 0x20, 0x01, 0x1c, 0x24, 0x01, 0x09, 0x24, 0x01,
+    0x01, 0xb4, 0x09, 0x01, 0x10, 0x01, 0x1a, 0x24, 0x01, 0x01, 0xb4, 0x07, 0x01, 0x10, 0x01, 0x1a,
+    0x14, 0x01, 0x01, 0xb4, 0x09, 0x01, 0x24, 0x01, 0x01, 0xbe, 0x01, 0x06, 0xb4, 0x01, 0x01, 0x20,
+    0x01, 0x19, 0x14, 0x01, 0x01, 0xbd, 0x01, 0x01, 0xeb, 0x05, 0x01, 0x42, 0x01, 0x01, 0x02, 0x1a,
+    0x01, 0x4b, 0x01, 0x01, 0xeb, 0x06, 0x01, 0x42, 0x01, 0x01, 0x14, 0x01, 0x01, 0xbd, 0x01, 0x01,
+    0xfd, 0x05, 0x01, 0xb4, 0x01, 0x01, 0x10, 0x01, 0x18, 0x24, 0x01, 0x01, 0xbe, 0x01, 0x01, 0xfd,
+    0x05, 0x01, 0xb4, 0x01, 0x01, 0x10, 0x01, 0x18, 0x24, 0x01, 0x01, 0xbd, 0x01, 0x01, 0xfd, 0x05,
+    0x01, 0xb4, 0x01, 0x01, 0x10, 0x01, 0x01, 0x24, 0x01, 0x01, 0xbe, 0x01, 0x01, 0xfe, 0x04, 0x01,
+    0xb4, 0x01, 0x01, 0x20, 0x01, 0x17, 0x14, 0x01, 0x01, 0xbd, 0x01, 0x01, 0xfe, 0x06, 0x01, 0xb4,
+    0x01, 0x01, 0x20, 0x01, 0x17, 0x14, 0x01, 0x01, 0xbd, 0x01, 0x01, 0xfe, 0x05, 0x01, 0xb4, 0x01,
+    0x01, 0x20, 0x01, 0x02, 0x14, 0x01, 0x01, 0xbd, 0x01, 0x01, 0xfd, 0x05, 0x01, 0xb4, 0x01, 0x01,
+    0x10, 0x01, 0x16, 0x24, 0x01, 0x01, 0xbe, 0x01, 0x01, 0xfd, 0x07, 0x01, 0xb4, 0x01, 0x01, 0x10,
+    0x01, 0x16, 0x24, 0x01, 0x01, 0xbe, 0x01, 0x01, 0xfd, 0x05, 0x01, 0xb4, 0x01, 0x01, 0x10, 0x01,
+    0x03, 0x24, 0x01, 0x01, 0xbe, 0x01, 0x01, 0xfe, 0x04, 0x01, 0xb4, 0x01, 0x01, 0x20, 0x01, 0x15,
+    0x14, 0x01, 0x01, 0xbd, 0x01, 0x01, 0xfe, 0x08, 0x01, 0xb4, 0x01, 0x01, 0x20, 0x01, 0x15, 0x14,
+    0x01, 0x01, 0xbd, 0x01, 0x01, 0xfe, 0x05, 0x01, 0xb4, 0x01, 0x01, 0x20, 0x01, 0x04, 0x14, 0x01,
+    0x01, 0xbd, 0x01, 0x01, 0xfd, 0x05, 0x01, 0xb4, 0x01, 0x01, 0x10, 0x01, 0x14, 0x24, 0x01, 0x01,
+    0xbe, 0x01, 0x01, 0xfd, 0x09, 0x01, 0xb4, 0x01, 0x01, 0x10, 0x01, 0x14, 0x24, 0x01, 0x01, 0xbe,
+    0x01, 0x01, 0xfd, 0x05, 0x01, 0xb4, 0x01, 0x01, 0x10, 0x01, 0x05, 0x24, 0x01, 0x01, 0xbe, 0x01,
+    0x01, 0xfe, 0x04, 0x01, 0xb4, 0x01, 0x01, 0x20, 0x01, 0x13, 0x14, 0x01, 0x01, 0xbd, 0x01, 0x01,
+    0xfe, 0x0a, 0x01, 0xb4, 0x01, 0x01, 0x20, 0x01, 0x13, 0x14, 0x01, 0x01, 0xbd, 0x01, 0x01, 0xfe,
+    0x05, 0x01, 0xb4, 0x01, 0x01, 0x20, 0x01, 0x06, 0x14, 0x01, 0x01, 0xbd, 0x01, 0x01, 0xfd, 0x05,
+    0x01, 0xb4, 0x01, 0x01, 0x20, 0x01, 0x12, 0x14, 0x01, 0x01, 0xbe, 0x01, 0x01, 0xfd, 0x0b, 0x01,
+    0xb4, 0x01, 0x01, 0x10, 0x01, 0x12, 0x24, 0x01, 0x01, 0xbe, 0x01, 0x01, 0xfd, 0x05, 0x01, 0xb4,
+    0x01, 0x01, 0x10, 0x01, 0x07, 0x24, 0x01, 0x01, 0xbe, 0x01, 0x01, 0xfd, 0x05, 0x01, 0xb4, 0x01,
+    0x01, 0x10, 0x01, 0x11, 0x24, 0x01, 0x01, 0xbe, 0x01, 0x01, 0xfe, 0x05, 0x01, 0xfe, 0x05, 0x01,
+    0xb4, 0x01, 0x01, 0x20, 0x01, 0x11, 0x14, 0x01, 0x01, 0xbd, 0x01, 0x01, 0xfd, 0x05, 0x01, 0xb4,
+    0x01, 0x01, 0x20, 0x01, 0x08, 0x14, 0x01, 0x01, 0xbd, 0x01, 0x01, 0xfe, 0x05, 0x01, 0xb4, 0x01,
+    0x01, 0x20, 0x01, 0x10, 0x14, 0x01, 0x01, 0xbd, 0x01, 0x01, 0xfd, 0x05, 0x01, 0xbd, 0x01, 0x01,
+    0xfd, 0x05, 0x01, 0xb4, 0x01, 0x01, 0x10, 0x01, 0x10, 0x24, 0x01, 0x01, 0xbe, 0x01, 0x01, 0xfe,
+    0x04, 0x01, 0xb4, 0x01, 0x01, 0x20, 0x01, 0x0a, 0x24, 0x01, 0x01, 0xbe, 0x01, 0x01, 0xfd, 0x05,
+    0x01, 0xb4, 0x01, 0x01, 0x10, 0x01, 0x0f, 0x24, 0x01, 0x01, 0xbe, 0x01, 0x01, 0xfe, 0x04, 0x01,
+    0xb4, 0x01, 0x01, 0xbe, 0x01, 0x01, 0xfe, 0x04, 0x01, 0xb4, 0x01, 0x01, 0x20, 0x01, 0x0f, 0x14,
+    0x01, 0x01, 0xbd, 0x01, 0x01, 0xfd, 0x05, 0x01, 0xb4, 0x01, 0x01, 0x10, 0x01, 0x0a, 0x14, 0x01,
+    0x01, 0xbd, 0x01, 0x01, 0xfe, 0x05, 0x01, 0xb4, 0x01, 0x01, 0x20, 0x01, 0x0e, 0x14, 0x01, 0x01,
+    0xbd, 0x01, 0x01, 0xfd, 0x05, 0x01, 0xb4, 0x01, 0x01, 0xbd, 0x01, 0x01, 0xfd, 0x05, 0x01, 0xb4,
+    0x01, 0x01, 0x10, 0x01, 0x0e, 0x24, 0x01, 0x01, 0xbe, 0x01, 0x01, 0xfe, 0x04, 0x01, 0xb4, 0x01,
+    0x01, 0x20, 0x01, 0x0c, 0x24, 0x01, 0x01, 0xbe, 0x01, 0x01, 0xfd, 0x05, 0x01, 0xb4, 0x01, 0x01,
+    0x10, 0x01, 0x0d, 0x24, 0x01, 0x01, 0xbe, 0x01, 0x01, 0xfe, 0x04, 0x01, 0xb4, 0x01, 0x01, 0x24,
+    0x01, 0x01, 0xbe, 0x01, 0x01, 0xfe, 0x04, 0x01, 0xb4, 0x01, 0x01, 0x20, 0x01, 0x0d, 0x14, 0x01,
+    0x01, 0xbd, 0x01, 0x01, 0xfd, 0x05, 0x01, 0xb4, 0x01, 0x01, 0x10, 0x01, 0x0c, 0x14, 0x01, 0x01,
+    0xbd, 0x01, 0x01, 0xfe, 0x05, 0x01, 0xb4, 0x01, 0x01, 0x20, 0x01, 0x0c, 0x14, 0x01, 0x01, 0xbd,
+    0x01, 0x01, 0xfd, 0x05, 0x01, 0xb4, 0x01, 0x01, 0x14, 0x01, 0x01, 0xbd, 0x01, 0x01, 0xfd, 0x05,
+    0x01, 0xb4, 0x01, 0x01, 0x10, 0x01, 0x0c, 0x24, 0x01, 0x01, 0xbe, 0x01, 0x01, 0xfe, 0x04, 0x01,
+    0xb4, 0x01, 0x01, 0x20, 0x01, 0x0e, 0x24, 0x01, 0x01, 0xbd, 0x01, 0x01, 0xfd, 0x05, 0x01, 0xb4,
+    0x01, 0x01, 0x10, 0x01, 0x0b, 0x24, 0x01, 0x01, 0xbe, 0x01, 0x01, 0xfe, 0x04, 0x01, 0xb4, 0x01,
+    0x01, 0x20, 0x01, 0x01, 0x24, 0x01, 0x01, 0xbe, 0x01, 0x01, 0xfe, 0x04, 0x01, 0xb4, 0x01, 0x01,
+    0x20, 0x01, 0x0b, 0x24, 0x01, 0x01, 0xbd, 0x01, 0x01, 0xfd, 0x05, 0x01, 0xb4, 0x01, 0x01, 0x10,
+    0x01, 0x0f, 0x24, 0x01, 0x01, 0xbe, 0x01, 0x01, 0xfe, 0x04, 0x01, 0xb4, 0x01, 0x01, 0x20, 0x01,
+    0x0a, 0x14, 0x01, 0x01, 0xbd, 0x01, 0x01, 0xfd, 0x05, 0x01, 0xb4, 0x01, 0x01, 0x10, 0x01, 0x01,
+    0x14, 0x01, 0x01, 0xbd, 0x01, 0x01, 0xfd, 0x05, 0x01, 0xb4, 0x01, 0x01, 0x10, 0x01, 0x09, 0x14,
+    0x01, 0x01, 0xbd, 0x01, 0x01, 0xfe, 0x05, 0x01, 0xb4, 0x01, 0x01, 0x20, 0x01, 0x10, 0x14, 0x01,
+    0x01, 0xbd, 0x01, 0x01, 0xfd, 0x05, 0x01, 0xb4, 0x01, 0x01, 0x10, 0x01, 0x09, 0x24, 0x01, 0x01,
+    0xbe, 0x01, 0x01, 0xfe, 0x04, 0x01, 0xb4, 0x01, 0x01, 0x20, 0x01, 0x03, 0x24, 0x01, 0x01, 0xbe,
+    0x01, 0x01, 0xfe, 0x04, 0x01, 0xb4, 0x01, 0x01, 0x10, 0x01, 0x09, 0x24, 0x01, 0x01, 0xbe, 0x01,
+    0x01, 0xfd, 0x05, 0x01, 0xb4, 0x01, 0x01, 0x10, 0x01, 0x11, 0x24, 0x01, 0x01, 0xbe, 0x01, 0x01,
+    0xfe, 0x04, 0x01, 0xb4, 0x01, 0x01, 0x20, 0x01, 0x08, 0x14, 0x01, 0x01, 0xbd, 0x01, 0x01, 0xfd,
+    0x05, 0x01, 0xb4, 0x01, 0x01, 0x10, 0x01, 0x03, 0x14, 0x01, 0x01, 0xbd, 0x01, 0x01, 0xfe, 0x04,
+    0x01, 0xb4, 0x01, 0x01, 0x20, 0x01, 0x08, 0x14, 0x01, 0x01, 0xbd, 0x01, 0x01, 0xfe, 0x05, 0x01,
+    0xb4, 0x01, 0x01, 0x20, 0x01, 0x12, 0x14, 0x01, 0x01, 0xbd, 0x01, 0x01, 0xfd, 0x05, 0x01, 0xb4,
+    0x01, 0x01, 0x10, 0x01, 0x07, 0x24, 0x01, 0x01, 0xbe, 0x01, 0x01, 0xfe, 0x04, 0x01, 0xb4, 0x01,
+    0x01, 0x20, 0x01, 0x05, 0x24, 0x01, 0x01, 0xbe, 0x01, 0x01, 0xfd, 0x04, 0x01, 0xb4, 0x01, 0x01,
+    0x10, 0x01, 0x07, 0x24, 0x01, 0x01, 0xbe, 0x01, 0x01, 0xfd, 0x05, 0x01, 0xb4, 0x01, 0x01, 0x10,
+    0x01, 0x13, 0x24, 0x01, 0x01, 0xbe, 0x01, 0x01, 0xfe, 0x04, 0x01, 0xb4, 0x01, 0x01, 0x20, 0x01,
+    0x06, 0x14, 0x01, 0x01, 0xbd, 0x01, 0x01, 0xfd, 0x05, 0x01, 0xb4, 0x01, 0x01, 0x10, 0x01, 0x05,
+    0x14, 0x01, 0x01, 0xbe, 0x01, 0x01, 0xfe, 0x04, 0x01, 0xb4, 0x01, 0x01, 0x20, 0x01, 0x06, 0x14,
+    0x01, 0x01, 0xbd, 0x01, 0x01, 0xfe, 0x05, 0x01, 0xb4, 0x01, 0x01, 0x20, 0x01, 0x14, 0x14, 0x01,
+    0x01, 0xbd, 0x01, 0x01, 0xfd, 0x05, 0x01, 0xb4, 0x01, 0x01, 0x20, 0x01, 0x05, 0x24, 0x01, 0x01,
+    0xbe, 0x01, 0x01, 0xfe, 0x04, 0x01, 0xb4, 0x01, 0x01, 0x20, 0x01, 0x06, 0x14, 0x01, 0x01, 0xbd,
+    0x01, 0x01, 0xfd, 0x05, 0x01, 0xb4, 0x01, 0x01, 0x10, 0x01, 0x05, 0x24, 0x01, 0x01, 0xbe, 0x01,
+    0x01, 0xfd, 0x05, 0x01, 0xb4, 0x01, 0x01, 0x10, 0x01, 0x15, 0x24, 0x01, 0x01, 0xbe, 0x01, 0x01,
+    0xfd, 0x05, 0x01, 0xb4, 0x01, 0x01, 0x10, 0x01, 0x03, 0x14, 0x01, 0x01, 0xbd, 0x01, 0x01, 0xfd,
+    0x05, 0x01, 0xb4, 0x01, 0x01, 0x10, 0x01, 0x07, 0x24, 0x01, 0x01, 0xbe, 0x01, 0x01, 0xfe, 0x04,
+    0x01, 0xb4, 0x01, 0x01, 0x20, 0x01, 0x04, 0x14, 0x01, 0x01, 0xbd, 0x01, 0x01, 0xfe, 0x05, 0x01,
+    0xb4, 0x01, 0x01, 0x20, 0x01, 0x16, 0x14, 0x01, 0x01, 0xbd, 0x01, 0x01, 0xfe, 0x05, 0x01, 0xb4,
+    0x01, 0x01, 0x20, 0x01, 0x03, 0x24, 0x01, 0x01, 0xbe, 0x01, 0x01, 0xfe, 0x04, 0x01, 0xb4, 0x01,
+    0x01, 0x20, 0x01, 0x08, 0x14, 0x01, 0x01, 0xbd, 0x01, 0x01, 0xfd, 0x05, 0x01, 0xb4, 0x01, 0x01,
+    0x10, 0x01, 0x03, 0x24, 0x01, 0x01, 0xbe, 0x01, 0x01, 0xfd, 0x05, 0x01, 0xb4, 0x01, 0x01, 0x10,
+    0x01, 0x17, 0x24, 0x01, 0x01, 0xbe, 0x01, 0x01, 0xfd, 0x05, 0x01, 0xb4, 0x01, 0x01, 0x10, 0x01,
+    0x01, 0x14, 0x01, 0x01, 0xbd, 0x01, 0x01, 0xfd, 0x05, 0x01, 0xb4, 0x01, 0x01, 0x10, 0x01, 0x09,
+    0x24, 0x01, 0x01, 0xbe, 0x01, 0x01, 0xfe, 0x04, 0x01, 0xb4, 0x01, 0x01, 0x20, 0x01, 0x02, 0x14,
+    0x01, 0x01, 0xbd, 0x01, 0x01, 0xfd, 0x05, 0x01, 0xb4, 0x01, 0x01, 0x20, 0x01, 0x18, 0x14, 0x01,
+    0x01, 0xbd, 0x01, 0x01, 0xfe, 0x05, 0x01, 0xb4, 0x01, 0x01, 0x20, 0x01, 0x01, 0x14, 0x01, 0x01,
+    0xbe, 0x01, 0x01, 0xfe, 0x04, 0x01, 0xb4, 0x01, 0x01, 0x20, 0x01, 0x0a, 0x14, 0x01, 0x01, 0xbd,
+    0x01, 0x01, 0xfd, 0x05, 0x01, 0xb4, 0x01, 0x01, 0x10, 0x01, 0x01, 0x24, 0x01, 0x01, 0xbe, 0x01,
+    0x01, 0xfe, 0x04, 0x01, 0xb4, 0x01, 0x01, 0x20, 0x01, 0x1a, 0x24, 0x01, 0x01, 0xbe, 0x01, 0x01,
+    0xfd, 0x05, 0x01, 0xb4, 0x01, 0x01, 0x12, 0x01, 0x01, 0x4b, 0x01, 0x01, 0xef, 0x01, 0x04, 0xeb,
+    0x01, 0x01, 0x41, 0x01, 0x01, 0x02, 0x0b, 0x01, 0x4b, 0x01, 0x01, 0xef, 0x01, 0x04, 0xeb, 0x01,
+    0x01, 0x42, 0x01, 0x01, 0x14, 0x01, 0x01, 0xbd, 0x01, 0x01, 0xfd, 0x05, 0x01, 0xb4, 0x01, 0x01,
+    0x10, 0x01, 0x1a, 0x14, 0x01, 0x01, 0xbd, 0x01, 0x01, 0xfe, 0x05, 0x01, 0xb4, 0x01, 0x01, 0x24,
+    0x01, 0x01, 0xbd, 0x01, 0x01, 0xfd, 0x05, 0x01, 0xb4, 0x01, 0x01, 0x10, 0x01, 0x0b, 0x14, 0x01,
+    0x01, 0xbd, 0x01, 0x01, 0xfd, 0x05, 0x01, 0xb4, 0x01, 0x01, 0x24, 0x01, 0x01, 0xbe, 0x01, 0x01,
+    0xfe, 0x04, 0x01, 0xb4, 0x01, 0x01, 0x20, 0x01, 0x1c, 0x24, 0x01, 0x01, 0xbd, 0x01, 0x01, 0xfd,
+    0x05, 0x01, 0xb4, 0x01, 0x02, 0xbe, 0x01, 0x01, 0xfe, 0x04, 0x01, 0xb4, 0x01, 0x01, 0x20, 0x01,
+    0x0d, 0x24, 0x01, 0x01, 0xbe, 0x01, 0x01, 0xfe, 0x04, 0x01, 0xb4, 0x01, 0x02, 0xbd, 0x01, 0x01,
+    0xfd, 0x05, 0x01, 0xb4, 0x01, 0x01, 0x10, 0x01, 0x1d, 0x24, 0x01, 0x01, 0xbe, 0x01, 0x01, 0xfe,
+    0x04, 0x01, 0xb4, 0x01, 0x01, 0xbd, 0x01, 0x01, 0xfd, 0x05, 0x01, 0xb4, 0x01, 0x01, 0x10, 0x01,
+    0x0d, 0x14, 0x01, 0x01, 0xbd, 0x01, 0x01, 0xfd, 0x05, 0x01, 0xb4, 0x01, 0x01, 0xbe, 0x01, 0x01,
+    0xfe, 0x04, 0x01, 0xb4, 0x01, 0x01, 0x20, 0x01, 0x1e, 0x14, 0x01, 0x01, 0xbd, 0x01, 0x01, 0xfd,
+    0x05, 0x01, 0xbd, 0x01, 0x01, 0xfe, 0x05, 0x01, 0xb4, 0x01, 0x01, 0x20, 0x01, 0x0f, 0x24, 0x01,
+    0x01, 0xbe, 0x01, 0x01, 0xfd, 0x05, 0x01, 0xbd, 0x01, 0x01, 0xfd, 0x05, 0x01, 0xb4, 0x01, 0x01,
+    0x10, 0x01, 0x1f, 0x24, 0x01, 0x01, 0xbe, 0x01, 0x01, 0xfe, 0x05, 0x01, 0xfd, 0x06, 0x01, 0xb4,
+    0x01, 0x01, 0x10, 0x01, 0x0f, 0x14, 0x01, 0x01, 0xbd, 0x01, 0x01, 0xfe, 0x06, 0x01, 0xfe, 0x05,
+    0x01, 0xb4, 0x01, 0x01, 0x20, 0x01, 0x20, 0x14, 0x01, 0x01, 0xbd, 0x01, 0x01, 0xfe, 0x0b, 0x01,
+    0xb4, 0x01, 0x01, 0x20, 0x01, 0x11, 0x24, 0x01, 0x01, 0xbe, 0x01, 0x01, 0xfd, 0x0b, 0x01, 0xb4,
+    0x01, 0x01, 0x10, 0x01, 0x21, 0x24, 0x01, 0x01, 0xbe, 0x01, 0x01, 0xfd, 0x0a, 0x01, 0xb4, 0x01,
+    0x01, 0x10, 0x01, 0x11, 0x14, 0x01, 0x01, 0xbd, 0x01, 0x01, 0xfe, 0x0a, 0x01, 0xb4, 0x01, 0x01,
+    0x20, 0x01, 0x22, 0x14, 0x01, 0x01, 0xbd, 0x01, 0x01, 0xfe, 0x09, 0x01, 0xb4, 0x01, 0x01, 0x20,
+    0x01, 0x13, 0x24, 0x01, 0x01, 0xbe, 0x01, 0x01, 0xfd, 0x09, 0x01, 0xb4, 0x01, 0x01, 0x10, 0x01,
+    0x23, 0x24, 0x01, 0x01, 0xbe, 0x01, 0x01, 0xfd, 0x08, 0x01, 0xb4, 0x01, 0x01, 0x10, 0x01, 0x13,
+    0x14, 0x01, 0x01, 0xbd, 0x01, 0x01, 0xfe, 0x08, 0x01, 0xb4, 0x01, 0x01, 0x20, 0x01, 0x24, 0x14,
+    0x01, 0x01, 0xbd, 0x01, 0x01, 0xfe, 0x07, 0x01, 0xb4, 0x01, 0x01, 0x20, 0x01, 0x15, 0x24, 0x01,
+    0x01, 0xbe, 0x01, 0x01, 0xfd, 0x07, 0x01, 0xb4, 0x01, 0x01, 0x10, 0x01, 0x25, 0x24, 0x01, 0x01,
+    0xbe, 0x01, 0x07, 0xdb, 0x01, 0x01, 0x41, 0x01, 0x01, 0x01, 0x15, 0x01, 0x4b, 0x01, 0x01, 0xeb,
+    0x08, 0x01, 0x42, 0x01, 0x01, 0x01, 0x26, 0x01, 0x4b, 0x01, 0x09, 0x42, 0x01, 0x01, 0x01, 0x16,
+    0x01, 0x4b, 0x01, 0x0a, 0x41, 0x01, 0x01, 0x02, 0x27, 0x01, 0x42, 0x09, 0x01, 0x02, 0x18, 0x01,
+    0x42, 0x0a, 0x01, 0x01, 0x29, 0x09, 0x01, 0x1a, 0x0a, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
+    0x2d, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x50, 0x01, 0x00, 0x00, 0x70, 0x01, 0x00, 0x00,
+    0x52, 0x0e, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x02, 0x15, 0x00,
+    0x1d, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x61, 0x02, 0x00, 0x00, 0x14, 0x04, 0x24, 0x00,
+    0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x20,
+    0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x20,
+    0x07, 0x00, 0x07, 0x20, 0x43, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x43, 0x20, 0x07, 0x20, 0x43, 0x55, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x55, 0x43, 0x20, 0x43, 0x55, 0xaa, 0xbc,
+    0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xbc, 0xaa, 0x55,
+    0x43, 0x55, 0xaa, 0xbc, 0xbc, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xbc, 0xbc, 0xaa, 0x55, 0x55, 0xaa, 0xd4, 0xaa, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xaa, 0xd4, 0xaa, 0x55, 0x55, 0xaa, 0xd4, 0xaa, 0x55,
+    0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x55, 0xaa, 0xd4, 0xaa, 0x55,
+    0x55, 0xaa, 0xd4, 0xaa, 0x55, 0x43, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a,
+    0x55, 0xaa, 0xd4, 0xaa, 0x55, 0x55, 0xaa, 0xd4, 0xbc, 0xaa, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xaa, 0xd4, 0xaa, 0x55, 0x55, 0xaa, 0xd4, 0xdf, 0xbc, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xbc, 0xd4, 0xaa, 0x55, 0x55,
+    0xaa, 0xd4, 0xdf, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4,
+    0xdf, 0xd4, 0xaa, 0x55, 0x55, 0xaa, 0xd4, 0xbc, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xbc, 0xd4, 0xaa, 0x55, 0x55, 0xaa, 0xd4, 0xaa, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xaa, 0xd4, 0xaa, 0x55, 0x55, 0xaa,
+    0xd4, 0xaa, 0x55, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x55, 0xaa,
+    0xd4, 0xaa, 0x55, 0x55, 0xaa, 0xd4, 0xaa, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0xaa, 0xd4, 0xaa, 0x55, 0x55, 0xaa, 0xbc, 0xbc, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xbc, 0xbc, 0xaa, 0x55, 0x43, 0x55, 0xaa,
+    0xbc, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xd4, 0xbc, 0xaa,
+    0x55, 0x43, 0x20, 0x43, 0x55, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xaa, 0xaa, 0xaa, 0x55, 0x43, 0x20, 0x07, 0x20, 0x43, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x43, 0x20, 0x07, 0x00, 0x07, 0x20, 0x2a,
+    0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x2a, 0x20, 0x07,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x2a, 0x2a, 0x2a, 0x2a, 0x20, 0x07,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x20, 0x2a, 0x2a, 0x2a, 0x2a, 0x20, 0x07, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x20, 0x2a, 0x2a, 0x2a, 0x2a, 0x20, 0x43, 0x55, 0x55,
+    0x55, 0x55, 0x43, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x43, 0x55, 0x55, 0x55,
+    0x55, 0x43, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x43, 0x55, 0x55, 0x55, 0x55,
+    0x43, 0x55, 0xaa, 0xaa, 0xaa, 0xaa, 0x55, 0x2a, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x2a,
+    0x55, 0xaa, 0xaa, 0xaa, 0xaa, 0x55, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x2a, 0x55,
+    0xaa, 0xaa, 0xaa, 0xaa, 0x55, 0x43, 0x55, 0xaa, 0xd4, 0xaa, 0x55, 0x43, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0x43, 0x55, 0xaa, 0xd4, 0xd4, 0xaa, 0x55, 0x2a, 0x07, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0x43, 0x55, 0xaa, 0xd4, 0xaa, 0x55, 0x43, 0x2a, 0x55, 0xaa, 0xbc, 0xbc, 0xaa, 0x55,
+    0x2a, 0x07, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x55, 0xaa, 0xbc, 0xdf, 0xd4, 0xaa, 0x55, 0x43, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x2a, 0x55, 0xaa, 0xbc, 0xbc, 0xaa, 0x55, 0x2a, 0x20, 0x43, 0x55,
+    0xaa, 0xd4, 0xaa, 0x55, 0x43, 0x20, 0x00, 0x00, 0x00, 0x07, 0x2a, 0x55, 0xaa, 0xd4, 0xd4, 0xdf,
+    0xbc, 0xaa, 0x55, 0x2a, 0x07, 0x00, 0x00, 0x00, 0x20, 0x43, 0x55, 0xaa, 0xd4, 0xaa, 0x55, 0x43,
+    0x20, 0x07, 0x2a, 0x55, 0xaa, 0xbc, 0xbc, 0xaa, 0x55, 0x2a, 0x07, 0x00, 0x00, 0x20, 0x43, 0x55,
+    0xaa, 0xbc, 0xaa, 0xbc, 0xd4, 0xaa, 0x55, 0x43, 0x20, 0x00, 0x00, 0x07, 0x2a, 0x55, 0xaa, 0xbc,
+    0xbc, 0xaa, 0x55, 0x2a, 0x07, 0x00, 0x20, 0x43, 0x55, 0xaa, 0xd4, 0xaa, 0x55, 0x43, 0x20, 0x00,
+    0x07, 0x2a, 0x55, 0xaa, 0xbc, 0xaa, 0x55, 0xaa, 0xbc, 0xbc, 0xaa, 0x55, 0x2a, 0x07, 0x00, 0x20,
+    0x43, 0x55, 0xaa, 0xd4, 0xaa, 0x55, 0x43, 0x20, 0x00, 0x00, 0x07, 0x2a, 0x55, 0xaa, 0xbc, 0xbc,
+    0xaa, 0x55, 0x2a, 0x07, 0x20, 0x43, 0x55, 0xaa, 0xd4, 0xaa, 0x55, 0x55, 0xaa, 0xd4, 0xaa, 0x55,
+    0x43, 0x20, 0x07, 0x2a, 0x55, 0xaa, 0xbc, 0xbc, 0xaa, 0x55, 0x2a, 0x07, 0x00, 0x00, 0x00, 0x20,
+    0x43, 0x55, 0xaa, 0xd4, 0xaa, 0x55, 0x43, 0x20, 0x2a, 0x55, 0xaa, 0xbc, 0xbc, 0xaa, 0x55, 0x55,
+    0xaa, 0xbc, 0xbc, 0xaa, 0x55, 0x2a, 0x20, 0x43, 0x55, 0xaa, 0xd4, 0xaa, 0x55, 0x43, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0x2a, 0x55, 0xaa, 0xbc, 0xbc, 0xaa, 0x55, 0x2a, 0x43, 0x55, 0xaa, 0xd4,
+    0xaa, 0x55, 0x43, 0x43, 0x55, 0xaa, 0xd4, 0xaa, 0x55, 0x43, 0x2a, 0x55, 0xaa, 0xbc, 0xbc, 0xaa,
+    0x55, 0x2a, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x43, 0x55, 0xaa, 0xd4, 0xaa, 0x55, 0x43,
+    0x55, 0xaa, 0xbc, 0xbc, 0xaa, 0x55, 0x2a, 0x2a, 0x55, 0xaa, 0xbc, 0xbc, 0xaa, 0x55, 0x43, 0x55,
+    0xaa, 0xd4, 0xaa, 0x55, 0x43, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x2a, 0x55, 0xaa,
+    0xbc, 0xbc, 0xaa, 0x55, 0x55, 0xaa, 0xd4, 0xaa, 0x55, 0x43, 0x20, 0x20, 0x43, 0x55, 0xaa, 0xd4,
+    0xaa, 0x55, 0x55, 0xaa, 0xbc, 0xbc, 0xaa, 0x55, 0x2a, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0x43, 0x55, 0xaa, 0xd4, 0xaa, 0x55, 0xaa, 0xbc, 0xbc, 0xaa, 0x55, 0x2a, 0x07, 0x07,
+    0x2a, 0x55, 0xaa, 0xbc, 0xbc, 0xaa, 0x55, 0xaa, 0xd4, 0xaa, 0x55, 0x43, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x2a, 0x55, 0xaa, 0xbc, 0xbc, 0xaa, 0xbc, 0xd4, 0xaa, 0x55,
+    0x43, 0x20, 0x00, 0x00, 0x20, 0x43, 0x55, 0xaa, 0xd4, 0xbc, 0xaa, 0xbc, 0xbc, 0xaa, 0x55, 0x2a,
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x43, 0x55, 0xaa, 0xd4, 0xd4,
+    0xdf, 0xbc, 0xaa, 0x55, 0x2a, 0x07, 0x00, 0x00, 0x07, 0x2a, 0x55, 0xaa, 0xbc, 0xdf, 0xd4, 0xbc,
+    0xaa, 0x55, 0x43, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x2a,
+    0x55, 0xaa, 0xbc, 0xd4, 0xd4, 0xaa, 0x55, 0x43, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x43, 0x55,
+    0xaa, 0xd4, 0xd4, 0xaa, 0x55, 0x43, 0x20, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0x43, 0x55, 0xaa, 0xaa, 0xaa, 0xaa, 0x55, 0x2a, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0x2a, 0x55, 0xaa, 0xaa, 0xaa, 0xaa, 0x55, 0x2a, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x20, 0x43, 0x55, 0x55, 0x55, 0x55, 0x43, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x43, 0x55, 0x55, 0x55, 0x55, 0x43, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x20, 0x2a, 0x2a,
+    0x2a, 0x2a, 0x20, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x20, 0x2a, 0x2a, 0x2a, 0x2a,
+    0x20, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
+    0xd4, 0x10, 0x00, 0x00, 0xf4, 0x10, 0x00, 0x00, 0x75, 0x06, 0x00, 0x00,
+};
+
+#endif // TEST_FONTS_PACK_H
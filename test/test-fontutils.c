@@ -8,6 +8,8 @@
 
 #include "unity.h"
 #include "fontutils-api.h"
+#include "fonts-pack.h"
+#include <string.h>
 
 void check_get_alpha() {
     struct Color color = { .argb = 0xff000000 };
@@ -74,3 +76,596 @@ void check_font_length_different_sizes() {
     uint16_t len_large = font_api_length("Test", 20, 0);
     TEST_ASSERT_GREATER_THAN(len_small, len_large);
 }
+
+void check_font_scaled_metrics_match_float() {
+    static const char text[] = "AKWgjm08 .";
+    struct FontLayoutGlyph glyphs[sizeof(text)];
+    struct FontLayout layout = { .glyphs = glyphs, .capacity = sizeof(text) };
+    enum FontName fonts_under_test[] = {
+        FONT_KONEXY,
+#ifdef FONT_KONEXY_SDF_GENERATED
+        FONT_KONEXY_SDF,
+#endif
+    };
+
+    // Reference in double precision, whatever the scaling math of the build
+    for (uint8_t f = 0; f < sizeof(fonts_under_test) / sizeof(fonts_under_test[0]); f++) {
+        const struct Font *font = &fonts[fonts_under_test[f]];
+        for (uint16_t size = 6; size <= 240; size++) {
+            uint8_t l = 0;
+            while (l + 1 < font->level_count && font->levels[l].height < size)
+                l++;
+            double multiplier = (double)size / font->levels[l].height;
+
+            TEST_ASSERT_TRUE(font_api_layout(text, fonts_under_test[f], size, &layout));
+            double total = 0;
+            uint16_t pen = 0;
+            uint16_t count = 0;
+            for (const char *c = text; *c != '\0'; c++) {
+                uint8_t index = font->glyph_index[(uint8_t)*c];
+                if (index == GLYPH_INDEX_NONE)
+                    continue;
+                TEST_ASSERT_INT_WITHIN_MESSAGE(1, pen, layout.glyphs[count++].x, "Glyph positions should match within a pixel");
+                double advance = font->levels[l].glyphs[index].width * multiplier;
+                pen += (uint16_t)advance;
+                total += advance;
+            }
+            TEST_ASSERT_EQUAL_UINT16(count, layout.count);
+            TEST_ASSERT_INT_WITHIN_MESSAGE(1, (uint16_t)total, layout.width, "Text width should match within a pixel");
+            TEST_ASSERT_INT_WITHIN_MESSAGE(1, (uint16_t)total, font_api_length(text, size, fonts_under_test[f]), "Text length should match within a pixel");
+        }
+    }
+}
+
+static uint32_t line_calls;
+static uint32_t line_pixels;
+static uint32_t span_flushes;
+static uint32_t span_pixels;
+
+static void count_line(uint16_t x, uint16_t y, uint16_t lenght, struct Color color) {
+    (void)x;
+    (void)y;
+    (void)color;
+    line_calls++;
+    line_pixels += lenght;
+}
+
+static void count_spans(const struct FontSpan *spans, uint16_t count) {
+    span_flushes++;
+    for (uint16_t i = 0; i < count; i++)
+        span_pixels += spans[i].length;
+}
+
+void check_font_draw_spans_matches_lines() {
+    struct FontSpan storage[32];
+    struct FontSpanBuffer buffer = { storage, 32, 0, count_spans };
+    line_calls = line_pixels = span_flushes = span_pixels = 0;
+
+    font_api_draw(100, 10, FONT_ALIGN_LEFT, 0, "88", (struct Color){ .argb = 0xffffffff }, 48, count_line);
+    font_api_draw_spans(100, 10, FONT_ALIGN_LEFT, 0, "88", (struct Color){ .argb = 0xffffffff }, 48, &buffer);
+
+    TEST_ASSERT_GREATER_THAN(0, line_pixels);
+    TEST_ASSERT_EQUAL_UINT32(line_pixels, span_pixels);
+    TEST_ASSERT_LESS_THAN(line_calls, span_flushes);
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(0, buffer.count, "Buffer should be flushed on return");
+}
+
+#define TEST_FB_SIZE (256)
+static uint32_t fb_lines[TEST_FB_SIZE * TEST_FB_SIZE];
+static uint32_t fb_rects[TEST_FB_SIZE * TEST_FB_SIZE];
+static uint32_t rect_calls;
+
+static void fb_line(uint16_t x, uint16_t y, uint16_t lenght, struct Color color) {
+    line_calls++;
+    for (uint16_t i = 0; i < lenght; i++)
+        if (x + i < TEST_FB_SIZE && y < TEST_FB_SIZE)
+            fb_lines[y * TEST_FB_SIZE + x + i] = color.argb;
+}
+
+static void fb_rect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, struct Color color) {
+    rect_calls++;
+    for (uint16_t j = 0; j < h; j++)
+        for (uint16_t i = 0; i < w; i++)
+            if (x + i < TEST_FB_SIZE && y + j < TEST_FB_SIZE)
+                fb_rects[(y + j) * TEST_FB_SIZE + x + i] = color.argb;
+}
+
+void check_font_draw_rectangles_matches_lines() {
+    memset(fb_lines, 0, sizeof(fb_lines));
+    memset(fb_rects, 0, sizeof(fb_rects));
+    line_calls = rect_calls = 0;
+
+    font_api_draw(0, 0, FONT_ALIGN_LEFT, 0, "8", (struct Color){ .argb = 0xffffffff }, 200, fb_line);
+    font_api_draw_rectangles(0, 0, FONT_ALIGN_LEFT, 0, "8", (struct Color){ .argb = 0xffffffff }, 200, fb_rect);
+
+    TEST_ASSERT_EQUAL_MEMORY_MESSAGE(fb_lines, fb_rects, sizeof(fb_lines), "Rectangles should cover the same pixels as lines");
+    TEST_ASSERT_GREATER_THAN(0, rect_calls);
+    TEST_ASSERT_LESS_THAN(line_calls, rect_calls);
+}
+
+void check_find_glyph_index() {
+    const struct Glyph *glyph = find_glyph(0, 'A');
+    TEST_ASSERT_NOT_NULL(glyph);
+    TEST_ASSERT_EQUAL('A', glyph->character);
+    TEST_ASSERT_NULL(find_glyph(0, '\x7f'));
+    TEST_ASSERT_NULL(find_glyph(0, (char)0xe9));
+}
+
+void check_font_layout_matches_length() {
+    struct FontLayoutGlyph glyphs[8];
+    struct FontLayout layout = { .glyphs = glyphs, .capacity = 8 };
+
+    TEST_ASSERT_TRUE(font_api_layout("12.5", 0, 30, &layout));
+    TEST_ASSERT_EQUAL_UINT16(4, layout.count);
+    TEST_ASSERT_EQUAL_UINT16(font_api_length("12.5", 30, 0), layout.width);
+    TEST_ASSERT_EQUAL_UINT16(0, layout.glyphs[0].x);
+    TEST_ASSERT_GREATER_THAN(layout.glyphs[0].x, layout.glyphs[1].x);
+
+    TEST_ASSERT_FALSE_MESSAGE(font_api_layout("123456789", 0, 30, &layout), "Layout should not overflow the storage");
+}
+
+void check_font_draw_layout_matches_draw() {
+    struct FontLayoutGlyph glyphs[8];
+    struct FontLayout layout = { .glyphs = glyphs, .capacity = 8 };
+    struct FontTarget target = { .line_callback = fb_line };
+    memset(fb_lines, 0, sizeof(fb_lines));
+    memset(fb_rects, 0, sizeof(fb_rects));
+
+    font_api_draw(128, 0, FONT_ALIGN_CENTER, 0, "1.7", (struct Color){ .argb = 0xffffffff }, 60, fb_line);
+    memcpy(fb_rects, fb_lines, sizeof(fb_lines));
+    memset(fb_lines, 0, sizeof(fb_lines));
+
+    TEST_ASSERT_TRUE(font_api_layout("1.7", 0, 60, &layout));
+    font_api_draw_layout(128, 0, FONT_ALIGN_CENTER, &layout, (struct Color){ .argb = 0xffffffff }, &target);
+
+    TEST_ASSERT_EQUAL_MEMORY(fb_rects, fb_lines, sizeof(fb_lines));
+}
+
+void check_font_clip_restricts_pixels() {
+    struct FontClip clip = { 0, 50, TEST_FB_SIZE, 40 };
+    memset(fb_lines, 0, sizeof(fb_lines));
+    memset(fb_rects, 0, sizeof(fb_rects));
+
+    font_api_draw(0, 0, FONT_ALIGN_LEFT, 0, "8", (struct Color){ .argb = 0xffffffff }, 200, fb_line);
+    struct FontTarget target = { .rectangle_callback = fb_rect, .clip = &clip };
+    font_api_draw_target(0, 0, FONT_ALIGN_LEFT, 0, "8", (struct Color){ .argb = 0xffffffff }, 200, &target);
+
+    for (uint32_t y = 0; y < TEST_FB_SIZE; y++) {
+        for (uint32_t x = 0; x < TEST_FB_SIZE; x++) {
+            uint32_t expected = y >= clip.y && y < clip.y + clip.h ? fb_lines[y * TEST_FB_SIZE + x] : 0;
+            TEST_ASSERT_EQUAL_HEX32(expected, fb_rects[y * TEST_FB_SIZE + x]);
+        }
+    }
+}
+
+static uint32_t max_line_end;
+
+static void track_line(uint16_t x, uint16_t y, uint16_t lenght, struct Color color) {
+    (void)y;
+    (void)color;
+    line_calls++;
+    if ((uint32_t)x + lenght > max_line_end)
+        max_line_end = (uint32_t)x + lenght;
+}
+
+void check_font_align_does_not_wrap() {
+    line_calls = 0;
+    max_line_end = 0;
+
+    // Centered around x = 10, most of the text falls left of the screen
+    font_api_draw(10, 0, FONT_ALIGN_CENTER, 0, "888", (struct Color){ .argb = 0xffffffff }, 60, track_line);
+
+    TEST_ASSERT_GREATER_THAN(0, line_calls);
+    TEST_ASSERT_LESS_OR_EQUAL_MESSAGE(200, max_line_end, "Lines left of the screen should be cut, not wrapped");
+}
+
+void check_font_clip_skips_outside_glyphs() {
+    struct FontClip clip = { 0, 0, 50, 50 };
+    struct FontTarget target = { .line_callback = track_line, .clip = &clip };
+    line_calls = 0;
+    max_line_end = 0;
+
+    font_api_draw_target(100, 0, FONT_ALIGN_LEFT, 0, "88", (struct Color){ .argb = 0xffffffff }, 60, &target);
+    TEST_ASSERT_EQUAL_UINT32(0, line_calls);
+
+    font_api_draw_target(20, 0, FONT_ALIGN_LEFT, 0, "88", (struct Color){ .argb = 0xffffffff }, 60, &target);
+    TEST_ASSERT_GREATER_THAN(0, line_calls);
+    TEST_ASSERT_LESS_OR_EQUAL(50, max_line_end);
+}
+
+static uint32_t palette_misses;
+static const uint32_t *test_palette;
+
+static void palette_line(uint16_t x, uint16_t y, uint16_t lenght, struct Color color) {
+    (void)x;
+    (void)y;
+    (void)lenght;
+    line_calls++;
+    bool found = false;
+    for (uint8_t i = 0; i < FONT_PALETTE_SIZE; i++)
+        found |= test_palette[i] == color.argb;
+    if (!found)
+        palette_misses++;
+}
+
+void check_font_palette_emits_opaque_colors() {
+    uint32_t palette[FONT_PALETTE_SIZE];
+    font_api_blend_palette((struct Color){ .argb = 0xffffffff }, (struct Color){ .argb = 0xff000080 }, palette);
+    TEST_ASSERT_EQUAL_HEX32(0xff000080, palette[0]);
+    TEST_ASSERT_EQUAL_HEX32(0xfff0f0f8, palette[FONT_PALETTE_SIZE - 1]);
+
+    struct FontTarget target = { .line_callback = palette_line, .palette = palette };
+    test_palette = palette;
+    line_calls = palette_misses = 0;
+    font_api_draw_target(0, 0, FONT_ALIGN_LEFT, 0, "8", (struct Color){ .argb = 0xffffffff }, 40, &target);
+
+    TEST_ASSERT_GREATER_THAN(0, line_calls);
+    TEST_ASSERT_EQUAL_UINT32(0, palette_misses);
+}
+
+void check_font_glyph_cache_matches_decode() {
+    static struct FontGlyphCacheEntry entries[8];
+    static struct FontGlyphRun runs[2048];
+    struct FontGlyphCache cache;
+    font_api_glyph_cache_init(&cache, entries, 8, runs, 2048);
+    struct FontClip clip = { 0, 10, TEST_FB_SIZE, 30 };
+    struct FontTarget target = { .rectangle_callback = fb_rect, .clip = &clip };
+    memset(fb_rects, 0, sizeof(fb_rects));
+    rect_calls = 0;
+    font_api_draw_target(5, 0, FONT_ALIGN_LEFT, 0, "1.7", (struct Color){ .argb = 0xffffffff }, 50, &target);
+    memcpy(fb_lines, fb_rects, sizeof(fb_rects));
+    uint32_t decoded_calls = rect_calls;
+
+    target.glyph_cache = &cache;
+    for (uint8_t i = 0; i < 2; i++) {
+        memset(fb_rects, 0, sizeof(fb_rects));
+        rect_calls = 0;
+        font_api_draw_target(5, 0, FONT_ALIGN_LEFT, 0, "1.7", (struct Color){ .argb = 0xffffffff }, 50, &target);
+        TEST_ASSERT_EQUAL_MEMORY(fb_lines, fb_rects, sizeof(fb_rects));
+        TEST_ASSERT_EQUAL_UINT32(decoded_calls, rect_calls);
+    }
+    TEST_ASSERT_EQUAL_UINT32(3, cache.misses);
+    TEST_ASSERT_EQUAL_UINT32(3, cache.hits);
+    TEST_ASSERT_EQUAL_UINT16(3, cache.entry_count);
+}
+
+void check_font_merge_many_runs_per_row() {
+#if defined(FONT_KONEXY_SOFT_GENERATED) && defined(FONT_KONEXY_SDF_GENERATED)
+    static struct FontGlyphCacheEntry entries[4];
+    static struct FontGlyphRun runs[8192];
+    struct FontGlyphCache cache;
+    font_api_glyph_cache_init(&cache, entries, 4, runs, 8192);
+    struct Color white = { .argb = 0xffffffff };
+
+    // Soft edges give rows of more than FONT_MAX_OPEN_RECTS runs
+    enum FontName fonts_under_test[] = { FONT_KONEXY_SOFT, FONT_KONEXY_SDF };
+    for (uint8_t f = 0; f < 2; f++) {
+        memset(fb_lines, 0, sizeof(fb_lines));
+        font_api_draw(0, 0, FONT_ALIGN_LEFT, fonts_under_test[f], "WM", white, 120, fb_line);
+
+        struct FontTarget target = { .rectangle_callback = fb_rect };
+        memset(fb_rects, 0, sizeof(fb_rects));
+        font_api_draw_target(0, 0, FONT_ALIGN_LEFT, fonts_under_test[f], "WM", white, 120, &target);
+        TEST_ASSERT_EQUAL_MEMORY_MESSAGE(fb_lines, fb_rects, sizeof(fb_rects), "Merged rectangles should draw the same pixels");
+
+        target.glyph_cache = &cache;
+        memset(fb_rects, 0, sizeof(fb_rects));
+        font_api_draw_target(0, 0, FONT_ALIGN_LEFT, fonts_under_test[f], "WM", white, 120, &target);
+        TEST_ASSERT_EQUAL_MEMORY_MESSAGE(fb_lines, fb_rects, sizeof(fb_rects), "Cached rectangles should draw the same pixels");
+    }
+#else
+    TEST_IGNORE_MESSAGE("Needs the fonts of test/fonts.json");
+#endif
+}
+
+void check_font_glyph_cache_evicts_least_recent() {
+    static struct FontGlyphCacheEntry entries[2];
+    static struct FontGlyphRun runs[2048];
+    struct FontGlyphCache cache;
+    font_api_glyph_cache_init(&cache, entries, 2, runs, 2048);
+    struct FontTarget target = { .line_callback = fb_line, .glyph_cache = &cache };
+    struct Color white = { .argb = 0xffffffff };
+
+    font_api_draw_target(0, 0, FONT_ALIGN_LEFT, 0, "12", white, 30, &target);
+    font_api_draw_target(0, 0, FONT_ALIGN_LEFT, 0, "1", white, 30, &target);
+    font_api_draw_target(0, 0, FONT_ALIGN_LEFT, 0, "3", white, 30, &target);
+    TEST_ASSERT_EQUAL_UINT32(3, cache.misses);
+    font_api_draw_target(0, 0, FONT_ALIGN_LEFT, 0, "1", white, 30, &target);
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(3, cache.misses, "Most recent glyph should stay cached");
+    font_api_draw_target(0, 0, FONT_ALIGN_LEFT, 0, "2", white, 30, &target);
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(4, cache.misses, "Least recent glyph should be evicted");
+
+    // Runs stay packed after evictions
+    uint32_t total = 0;
+    for (uint16_t i = 0; i < cache.entry_count; i++) {
+        TEST_ASSERT_EQUAL_UINT32(total, cache.entries[i].first);
+        total += cache.entries[i].count;
+    }
+    TEST_ASSERT_EQUAL_UINT32(total, cache.run_count);
+
+    // Glyphs bigger than the whole storage are drawn without the cache
+    font_api_glyph_cache_init(&cache, entries, 2, runs, 4);
+    line_calls = 0;
+    font_api_draw_target(0, 0, FONT_ALIGN_LEFT, 0, "8", white, 30, &target);
+    TEST_ASSERT_GREATER_THAN(0, line_calls);
+    TEST_ASSERT_EQUAL_UINT16(0, cache.entry_count);
+}
+
+void check_font_uses_smallest_fitting_level() {
+    const struct Font *font = &fonts[0];
+    const struct FontLevel *smallest = &font->levels[0];
+    const struct FontLevel *full = &font->levels[font->level_count - 1];
+    uint8_t index = font->glyph_index['8'];
+
+    TEST_ASSERT_EQUAL_PTR(font->glyphs, full->glyphs);
+    for (uint8_t i = 1; i < font->level_count; i++)
+        TEST_ASSERT_GREATER_THAN(font->levels[i - 1].height, font->levels[i].height);
+
+    // Drawn at the height of a level, glyphs are not scaled at all
+    TEST_ASSERT_EQUAL_UINT16(smallest->glyphs[index].width, font_api_length("8", smallest->height, 0));
+    TEST_ASSERT_EQUAL_UINT16(full->glyphs[index].width, font_api_length("8", full->height, 0));
+    // Sizes above every level are scaled up from the full size glyphs
+    TEST_ASSERT_EQUAL_UINT16(2 * full->glyphs[index].width, font_api_length("8", 2 * full->height, 0));
+}
+
+void check_font_row_table_is_consistent() {
+#ifdef FONT_KONEXY_ROWS_GENERATED
+    const struct Font *font = &fonts[FONT_KONEXY_ROWS];
+    TEST_ASSERT_EQUAL_UINT8(FONT_FORMAT_RLE_ROWS, font->format);
+    for (uint8_t l = 0; l < font->level_count; l++) {
+        const struct FontLevel *level = &font->levels[l];
+        for (uint16_t g = 0; g < font->glyph_count; g++) {
+            const struct Glyph *glyph = &level->glyphs[g];
+            const uint8_t *data = &level->sdf_data[glyph->offset];
+            uint16_t start = 2 * glyph->height;
+            for (uint16_t row = 0; row < glyph->height; row++) {
+                uint16_t offset = data[2 * row] | (data[2 * row + 1] << 8);
+                uint16_t end = row + 1 < glyph->height ? data[2 * row + 2] | (data[2 * row + 3] << 8) : glyph->size;
+                TEST_ASSERT_EQUAL_UINT16_MESSAGE(start, offset, "Rows should follow each other");
+                TEST_ASSERT_EQUAL_UINT16_MESSAGE(0, (end - offset) % 3, "Rows should hold whole pairs of series");
+                uint16_t pixels = 0;
+                for (uint16_t p = offset; p < end; p += 3)
+                    pixels += data[p + 1] + data[p + 2];
+                TEST_ASSERT_LESS_OR_EQUAL_MESSAGE(glyph->width, pixels, "Series should not cross rows");
+                start = end;
+            }
+        }
+    }
+#else
+    TEST_IGNORE_MESSAGE("Needs the fonts of test/fonts.json");
+#endif
+}
+
+void check_font_rows_match_stream() {
+#ifdef FONT_KONEXY_ROWS_GENERATED
+    static const uint16_t sizes[] = { 20, 33, 50, 141, 200 };
+    struct FontClip clip = { 0, 30, TEST_FB_SIZE, 40 };
+    for (uint8_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+        for (uint8_t clipped = 0; clipped < 2; clipped++) {
+            struct FontTarget target = { .rectangle_callback = fb_rect, .clip = clipped ? &clip : NULL };
+            memset(fb_rects, 0, sizeof(fb_rects));
+            font_api_draw_target(2, 2, FONT_ALIGN_LEFT, FONT_KONEXY, "g8A", (struct Color){ .argb = 0xffffffff }, sizes[i], &target);
+            memcpy(fb_lines, fb_rects, sizeof(fb_rects));
+            memset(fb_rects, 0, sizeof(fb_rects));
+            font_api_draw_target(2, 2, FONT_ALIGN_LEFT, FONT_KONEXY_ROWS, "g8A", (struct Color){ .argb = 0xffffffff }, sizes[i], &target);
+            TEST_ASSERT_EQUAL_MEMORY_MESSAGE(fb_lines, fb_rects, sizeof(fb_rects), "Row-indexed glyphs should draw the same pixels");
+        }
+    }
+#else
+    TEST_IGNORE_MESSAGE("Needs the fonts of test/fonts.json");
+#endif
+}
+
+void check_font_sdf_scales_up_sharp() {
+#ifdef FONT_KONEXY_SDF_GENERATED
+    enum FontName font = FONT_KONEXY_SDF;
+    uint16_t size = 4 * fonts[font].levels[fonts[font].level_count - 1].height;
+    uint16_t width = font_api_length("8", size, font);
+    memset(fb_lines, 0, sizeof(fb_lines));
+    font_api_draw(10, 10, FONT_ALIGN_LEFT, font, "8", (struct Color){ .argb = 0xffffffff }, size, fb_line);
+
+    uint32_t opaque = 0, partial = 0;
+    for (uint32_t y = 0; y < TEST_FB_SIZE; y++) {
+        for (uint32_t x = 0; x < TEST_FB_SIZE; x++) {
+            uint8_t alpha = fb_lines[y * TEST_FB_SIZE + x] >> 24;
+            if (alpha == 0)
+                continue;
+            TEST_ASSERT_TRUE_MESSAGE(x >= 10 && x < 10u + width && y >= 10 && y < 10u + size, "Pixels should stay inside the glyph box");
+            if (alpha == 0xf0)
+                opaque++;
+            else
+                partial++;
+        }
+    }
+    TEST_ASSERT_GREATER_THAN(0, opaque);
+    // Edges stay about a pixel wide instead of growing with the scale
+    TEST_ASSERT_LESS_THAN_MESSAGE(opaque / 4, partial, "Scaled up edges should stay sharp");
+#else
+    TEST_IGNORE_MESSAGE("Needs the fonts of test/fonts.json");
+#endif
+}
+
+void check_font_sdf_clip_and_cache_match_lines() {
+#ifdef FONT_KONEXY_SDF_GENERATED
+    static struct FontGlyphCacheEntry entries[4];
+    static struct FontGlyphRun runs[2048];
+    struct FontGlyphCache cache;
+    font_api_glyph_cache_init(&cache, entries, 4, runs, 2048);
+    enum FontName font = FONT_KONEXY_SDF;
+    struct FontClip clip = { 0, 20, TEST_FB_SIZE, 25 };
+    memset(fb_lines, 0, sizeof(fb_lines));
+    font_api_draw(5, 0, FONT_ALIGN_LEFT, font, "1.7", (struct Color){ .argb = 0xffffffff }, 60, fb_line);
+    for (uint32_t y = 0; y < TEST_FB_SIZE; y++)
+        if (y < clip.y || y >= clip.y + clip.h)
+            memset(&fb_lines[y * TEST_FB_SIZE], 0, TEST_FB_SIZE * sizeof(fb_lines[0]));
+
+    struct FontTarget target = { .rectangle_callback = fb_rect, .clip = &clip };
+    for (uint8_t i = 0; i < 3; i++) {
+        memset(fb_rects, 0, sizeof(fb_rects));
+        font_api_draw_target(5, 0, FONT_ALIGN_LEFT, font, "1.7", (struct Color){ .argb = 0xffffffff }, 60, &target);
+        TEST_ASSERT_EQUAL_MEMORY(fb_lines, fb_rects, sizeof(fb_rects));
+        target.glyph_cache = &cache;
+    }
+    TEST_ASSERT_EQUAL_UINT32(3, cache.misses);
+    TEST_ASSERT_EQUAL_UINT32(3, cache.hits);
+#else
+    TEST_IGNORE_MESSAGE("Needs the fonts of test/fonts.json");
+#endif
+}
+
+static uint8_t pack_buffer[64 * 1024] __attribute__((aligned(4)));
+
+static void pack_write16(uint8_t *data, uint16_t value) {
+    data[0] = value & 0xff;
+    data[1] = value >> 8;
+}
+
+static void pack_write32(uint8_t *data, uint32_t value) {
+    pack_write16(data, value & 0xffff);
+    pack_write16(data + 2, value >> 16);
+}
+
+// Packs the smallest glyph level of the first generated font, like the generator does
+static uint32_t build_pack(void) {
+    const struct Font *font = &fonts[0];
+    const struct FontLevel *level = &font->levels[0];
+    uint32_t data_size = 0;
+    for (uint16_t g = 0; g < font->glyph_count; g++)
+        if (level->glyphs[g].offset + level->glyphs[g].size > data_size)
+            data_size = level->glyphs[g].offset + level->glyphs[g].size;
+
+    uint32_t index_offset = 16 + 32;
+    uint32_t glyphs_offset = index_offset + 256;
+    uint32_t data_offset = glyphs_offset + font->glyph_count * 16;
+    uint32_t levels_offset = (data_offset + data_size + 3) & ~3u;
+    uint32_t size = levels_offset + 16;
+    TEST_ASSERT_LESS_OR_EQUAL(sizeof(pack_buffer), size);
+    memset(pack_buffer, 0, size);
+
+    memcpy(pack_buffer, "LRFP", 4);
+    pack_write16(&pack_buffer[4], FONT_PACK_VERSION);
+    pack_write16(&pack_buffer[6], 1);
+    pack_write32(&pack_buffer[8], size);
+    uint8_t *record = &pack_buffer[16];
+    strcpy((char *)record, "test");
+    pack_write16(&record[16], font->size);
+    record[18] = font->format;
+    record[19] = 1;
+    record[20] = font->edges[0];
+    record[21] = font->edges[1];
+    pack_write16(&record[22], font->glyph_count);
+    pack_write32(&record[24], index_offset);
+    pack_write32(&record[28], levels_offset);
+
+    memcpy(&pack_buffer[index_offset], font->glyph_index, 256);
+    memcpy(&pack_buffer[glyphs_offset], level->glyphs, font->glyph_count * sizeof(struct Glyph));
+    memcpy(&pack_buffer[data_offset], level->sdf_data, data_size);
+    pack_write16(&pack_buffer[levels_offset], level->height);
+    pack_write32(&pack_buffer[levels_offset + 4], glyphs_offset);
+    pack_write32(&pack_buffer[levels_offset + 8], data_offset);
+    pack_write32(&pack_buffer[levels_offset + 12], data_size);
+    return size;
+}
+
+void check_font_pack_matches_generated() {
+    uint32_t size = build_pack();
+    struct Font pack_fonts[2];
+    struct FontLevel pack_levels[2];
+    struct FontPack pack;
+    TEST_ASSERT_TRUE(font_api_pack_load(&pack, pack_buffer, size, pack_fonts, 2, pack_levels, 2));
+    TEST_ASSERT_EQUAL_UINT8(1, pack.font_count);
+
+    enum FontName font;
+    TEST_ASSERT_FALSE(font_api_pack_find(&pack, "missing", &font));
+    TEST_ASSERT_TRUE(font_api_pack_find(&pack, "test", &font));
+    TEST_ASSERT_EQUAL_PTR(&pack_buffer[16 + 32], pack_fonts[0].glyph_index);
+
+    uint16_t height = fonts[0].levels[0].height;
+    memset(fb_lines, 0, sizeof(fb_lines));
+    font_api_draw(2, 2, FONT_ALIGN_LEFT, 0, "A8.", (struct Color){ .argb = 0xffffffff }, height, fb_line);
+    memcpy(fb_rects, fb_lines, sizeof(fb_lines));
+    memset(fb_lines, 0, sizeof(fb_lines));
+    font_api_draw(2, 2, FONT_ALIGN_LEFT, font, "A8.", (struct Color){ .argb = 0xffffffff }, height, fb_line);
+
+    TEST_ASSERT_EQUAL_MEMORY(fb_rects, fb_lines, sizeof(fb_lines));
+    TEST_ASSERT_EQUAL_UINT16(font_api_length("A8.", height, 0), font_api_length("A8.", height, font));
+    TEST_ASSERT_EQUAL_PTR(&pack_fonts[0].glyphs[fonts[0].glyph_index['A']], find_glyph(font, 'A'));
+}
+
+void check_font_unknown_is_ignored() {
+    // Past the generated fonts and the fonts of any registered pack
+    enum FontName font = (enum FontName)200;
+    struct FontLayoutGlyph glyphs[4];
+    struct FontLayout layout = { .glyphs = glyphs, .capacity = 4 };
+
+    TEST_ASSERT_NULL(find_glyph(font, 'A'));
+    TEST_ASSERT_EQUAL_UINT16(0, font_api_length("A8.", 20, font));
+    TEST_ASSERT_FALSE(font_api_layout("A8.", font, 20, &layout));
+    memset(fb_lines, 0, sizeof(fb_lines));
+    font_api_draw(2, 2, FONT_ALIGN_CENTER, font, "A8.", (struct Color){ .argb = 0xffffffff }, 20, fb_line);
+    font_api_draw(2, 2, FONT_ALIGN_LEFT, font, "A8.", (struct Color){ .argb = 0xffffffff }, 20, fb_line);
+    TEST_ASSERT_EACH_EQUAL_HEX8_MESSAGE(0, fb_lines, sizeof(fb_lines), "Unknown fonts should not be drawn");
+}
+
+void check_font_pack_rejects_invalid() {
+    uint32_t size = build_pack();
+    struct Font pack_fonts[2];
+    struct FontLevel pack_levels[2];
+    struct FontPack pack;
+
+    TEST_ASSERT_FALSE_MESSAGE(font_api_pack_load(&pack, pack_buffer, size - 4, pack_fonts, 2, pack_levels, 2), "Truncated pack should be rejected");
+    TEST_ASSERT_FALSE_MESSAGE(font_api_pack_load(&pack, pack_buffer, size, pack_fonts, 0, pack_levels, 2), "Fonts should fit the storage");
+
+    pack_buffer[4]++;
+    TEST_ASSERT_FALSE_MESSAGE(font_api_pack_load(&pack, pack_buffer, size, pack_fonts, 2, pack_levels, 2), "Other versions should be rejected");
+    pack_buffer[4]--;
+
+    // A glyph with data but no rows or columns to decode it into
+    uint32_t glyphs_offset = 16 + 32 + 256;
+    uint8_t *glyph = &pack_buffer[glyphs_offset + fonts[0].glyph_index['A'] * 16];
+    pack_write16(&glyph[10], 0);
+    TEST_ASSERT_FALSE_MESSAGE(font_api_pack_load(&pack, pack_buffer, size, pack_fonts, 2, pack_levels, 2), "Empty glyphs with data should be rejected");
+    pack_write16(&glyph[10], fonts[0].levels[0].glyphs[fonts[0].glyph_index['A']].width);
+    pack_write16(&glyph[12], 0x8000);
+    TEST_ASSERT_FALSE_MESSAGE(font_api_pack_load(&pack, pack_buffer, size, pack_fonts, 2, pack_levels, 2), "Glyphs taller than the decoders should be rejected");
+    pack_write16(&glyph[12], fonts[0].levels[0].glyphs[fonts[0].glyph_index['A']].height);
+
+    // First glyph data past the end of the level data, after a valid font
+    pack_write32(&pack_buffer[glyphs_offset + 4], 0x10000);
+    memset(pack_fonts, 0xa5, sizeof(pack_fonts));
+    memset(pack_levels, 0xa5, sizeof(pack_levels));
+    TEST_ASSERT_FALSE_MESSAGE(font_api_pack_load(&pack, pack_buffer, size, pack_fonts, 2, pack_levels, 2), "Glyphs outside the pack should be rejected");
+    TEST_ASSERT_EACH_EQUAL_HEX8_MESSAGE(0xa5, pack_fonts, sizeof(pack_fonts), "Storage should not be written by an invalid pack");
+    TEST_ASSERT_EACH_EQUAL_HEX8_MESSAGE(0xa5, pack_levels, sizeof(pack_levels), "Storage should not be written by an invalid pack");
+}
+
+void check_font_pack_loads_generator_output() {
+#if defined(FONT_KONEXY_SOFT_GENERATED) && defined(FONT_KONEXY_SDF_GENERATED)
+    struct Font pack_fonts[2];
+    struct FontLevel pack_levels[2];
+    struct FontPack pack;
+    TEST_ASSERT_TRUE(font_api_pack_load(&pack, fonts_pack, sizeof(fonts_pack), pack_fonts, 2, pack_levels, 2));
+    TEST_ASSERT_EQUAL_UINT8(2, pack.font_count);
+
+    // The pack fonts are the generated fonts with fewer characters
+    static const struct { const char *name; enum FontName generated; const char *text; } cases[] = {
+        { "soft", FONT_KONEXY_SOFT, "WM" },
+        { "distance", FONT_KONEXY_SDF, "W8" },
+    };
+    for (uint8_t i = 0; i < 2; i++) {
+        enum FontName font;
+        TEST_ASSERT_TRUE(font_api_pack_find(&pack, cases[i].name, &font));
+        TEST_ASSERT_EQUAL_UINT8(fonts[cases[i].generated].format, pack_fonts[i].format);
+
+        struct FontTarget target = { .rectangle_callback = fb_rect };
+        memset(fb_lines, 0, sizeof(fb_lines));
+        font_api_draw(2, 2, FONT_ALIGN_LEFT, cases[i].generated, cases[i].text, (struct Color){ .argb = 0xffffffff }, 90, fb_line);
+        memset(fb_rects, 0, sizeof(fb_rects));
+        font_api_draw_target(2, 2, FONT_ALIGN_LEFT, font, cases[i].text, (struct Color){ .argb = 0xffffffff }, 90, &target);
+        TEST_ASSERT_EQUAL_MEMORY(fb_lines, fb_rects, sizeof(fb_rects));
+        TEST_ASSERT_EQUAL_UINT16(font_api_length(cases[i].text, 90, cases[i].generated), font_api_length(cases[i].text, 90, font));
+    }
+#else
+    TEST_IGNORE_MESSAGE("Needs the fonts of test/fonts.json");
+#endif
+}
@@ -0,0 +1,275 @@
+#include "unity.h"
+#include "framebuffer-api.h"
+#include "raster-api.h"
+
+#include <string.h>
+
+#define TEST_FB_WIDTH (37)
+#define TEST_FB_HEIGHT (9)
+
+static uint32_t argb_pixels[TEST_FB_WIDTH * TEST_FB_HEIGHT];
+static uint16_t rgb565_pixels[TEST_FB_WIDTH * TEST_FB_HEIGHT];
+static uint8_t l8_pixels[TEST_FB_WIDTH * TEST_FB_HEIGHT];
+
+static uint8_t reference_blend(uint8_t src, uint8_t dst, uint8_t alpha) {
+    uint32_t value = (uint32_t)src * alpha + (uint32_t)dst * (255 - alpha);
+    return (uint8_t)((value + 127) / 255);
+}
+
+void check_framebuffer_fill_opaque() {
+    struct Framebuffer fb;
+    framebuffer_api_init(&fb, argb_pixels, TEST_FB_WIDTH, TEST_FB_HEIGHT, 0, FRAMEBUFFER_ARGB8888);
+    memset(argb_pixels, 0, sizeof(argb_pixels));
+
+    framebuffer_api_fill(&fb, 3, 2, 100, 3, (struct Color){ .argb = 0xFF123456 });
+
+    for (uint16_t y = 0; y < TEST_FB_HEIGHT; y++) {
+        for (uint16_t x = 0; x < TEST_FB_WIDTH; x++) {
+            uint32_t expected = x >= 3 && y >= 2 && y < 5 ? 0xFF123456 : 0;
+            TEST_ASSERT_EQUAL_HEX32(expected, argb_pixels[y * TEST_FB_WIDTH + x]);
+        }
+    }
+}
+
+void check_framebuffer_blend_matches_reference() {
+    struct Framebuffer fb;
+    framebuffer_api_init(&fb, argb_pixels, TEST_FB_WIDTH, TEST_FB_HEIGHT, 0, FRAMEBUFFER_ARGB8888);
+    for (uint32_t i = 0; i < TEST_FB_WIDTH * TEST_FB_HEIGHT; i++)
+        argb_pixels[i] = i * 0x9E3779B9u;
+
+    uint32_t before[TEST_FB_WIDTH];
+    struct Color color = { .argb = 0x80E01F7A };
+    for (uint8_t alpha = 1; alpha < 255; alpha += 7) {
+        color.a = alpha;
+        memcpy(before, argb_pixels, sizeof(before));
+        framebuffer_api_fill(&fb, 0, 0, TEST_FB_WIDTH, 1, color);
+
+        for (uint16_t x = 0; x < TEST_FB_WIDTH; x++) {
+            struct Color dst = { .argb = before[x] };
+            struct Color expected = { .b = reference_blend(color.b, dst.b, alpha),
+                                      .g = reference_blend(color.g, dst.g, alpha),
+                                      .r = reference_blend(color.r, dst.r, alpha),
+                                      .a = reference_blend(255, dst.a, alpha) };
+            TEST_ASSERT_EQUAL_HEX32(expected.argb, argb_pixels[x]);
+        }
+    }
+}
+
+void check_framebuffer_rgb565_blend_matches_reference() {
+    struct Framebuffer fb;
+    framebuffer_api_init(&fb, rgb565_pixels, TEST_FB_WIDTH, TEST_FB_HEIGHT, 0, FRAMEBUFFER_RGB565);
+    for (uint32_t i = 0; i < TEST_FB_WIDTH * TEST_FB_HEIGHT; i++)
+        rgb565_pixels[i] = (uint16_t)((i * 0x9E3779B9u) >> 16);
+    rgb565_pixels[0] = 0xFFFF;
+    rgb565_pixels[1] = 0x0000;
+
+    // Rows of eight pixels and the remaining ones are blended the same way
+    uint16_t before[TEST_FB_WIDTH];
+    struct Color color = { .argb = 0x80E01F7A };
+    for (uint8_t alpha = 1; alpha < 255; alpha += 7) {
+        color.a = alpha;
+        memcpy(before, rgb565_pixels, sizeof(before));
+        framebuffer_api_fill(&fb, 0, 0, TEST_FB_WIDTH, 1, color);
+
+        for (uint16_t x = 0; x < TEST_FB_WIDTH; x++) {
+            uint8_t r = (uint8_t)((before[x] >> 11) << 3);
+            uint8_t g = (uint8_t)(((before[x] >> 5) & 0x3F) << 2);
+            uint8_t b = (uint8_t)((before[x] & 0x1F) << 3);
+            r = reference_blend(color.r, r | r >> 5, alpha);
+            g = reference_blend(color.g, g | g >> 6, alpha);
+            b = reference_blend(color.b, b | b >> 5, alpha);
+            TEST_ASSERT_EQUAL_HEX16((uint16_t)(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)), rgb565_pixels[x]);
+        }
+    }
+
+    framebuffer_api_fill(&fb, 0, 1, TEST_FB_WIDTH, 1, (struct Color){ .argb = 0xFF123456 });
+    TEST_ASSERT_EACH_EQUAL_HEX16(0x11AA, &rgb565_pixels[TEST_FB_WIDTH], TEST_FB_WIDTH);
+}
+
+void check_framebuffer_rgb565_and_l8() {
+    struct Framebuffer fb;
+    framebuffer_api_init(&fb, rgb565_pixels, TEST_FB_WIDTH, TEST_FB_HEIGHT, 0, FRAMEBUFFER_RGB565);
+    framebuffer_api_clear(&fb, (struct Color){ .argb = 0x00FFFFFF });
+    TEST_ASSERT_EQUAL_HEX16(0xFFFF, rgb565_pixels[TEST_FB_WIDTH * TEST_FB_HEIGHT - 1]);
+    framebuffer_api_fill(&fb, 0, 0, 1, 1, (struct Color){ .argb = 0x80000000 });
+    TEST_ASSERT_EQUAL_HEX16(0x7BEF, rgb565_pixels[0]);
+
+    framebuffer_api_init(&fb, l8_pixels, TEST_FB_WIDTH, TEST_FB_HEIGHT, 0, FRAMEBUFFER_L8);
+    framebuffer_api_clear(&fb, (struct Color){ .argb = 0xFF000000 });
+    framebuffer_api_fill(&fb, 1, 0, 1, 1, (struct Color){ .argb = 0xFFFFFFFF });
+    TEST_ASSERT_EQUAL_UINT8(0, l8_pixels[0]);
+    TEST_ASSERT_EQUAL_UINT8(255, l8_pixels[1]);
+}
+
+void check_framebuffer_bind_renders() {
+    struct RasterBox box = { true, 1, { 30, 4, 20, 20 }, { .argb = 0xFF0000FF }, NULL };
+    struct Framebuffer fb;
+    struct RasterHandler hras;
+    framebuffer_api_init(&fb, argb_pixels, TEST_FB_WIDTH, TEST_FB_HEIGHT, 0, FRAMEBUFFER_ARGB8888);
+    memset(argb_pixels, 0, sizeof(argb_pixels));
+    raster_api_init(&hras, &box, 1, NULL, NULL, NULL);
+    framebuffer_api_bind(&hras, &fb);
+
+    raster_api_render(&hras);
+
+    // Without partial rendering, the bound clear screen callback fills the background
+    TEST_ASSERT_EQUAL_HEX32(RASTER_PARTIAL != 0 ? 0 : fb.clear_color.argb, argb_pixels[4 * TEST_FB_WIDTH + 29]);
+    TEST_ASSERT_EQUAL_HEX32(0xFF0000FF, argb_pixels[4 * TEST_FB_WIDTH + 30]);
+    TEST_ASSERT_EQUAL_HEX32(0xFF0000FF, argb_pixels[TEST_FB_HEIGHT * TEST_FB_WIDTH - 1]);
+}
+
+#define TEST_TEXT_FB_WIDTH (120)
+#define TEST_TEXT_FB_HEIGHT (150)
+
+void check_framebuffer_opaque_text_matches_blending() {
+    static uint32_t blended[TEST_TEXT_FB_WIDTH * TEST_TEXT_FB_HEIGHT];
+    static uint32_t opaque_pixels[TEST_TEXT_FB_WIDTH * TEST_TEXT_FB_HEIGHT];
+    // Drawn at the generated size, so that no glyph run overlaps another
+    struct RasterLabel label;
+    raster_api_create_label(&label,
+                            (union RasterLabelData){ .int_val = 8 },
+                            LABEL_DATA_INT,
+                            (union RasterLabelFormat){ .int_fmt = raster_api_int_format(false) },
+                            (struct RasterCoords){ 2, 2 },
+                            0,
+                            fonts[0].glyphs[0].height,
+                            FONT_ALIGN_LEFT,
+                            (struct Color){ .argb = 0xFFF0C020 });
+    struct RasterLabel opaque = label;
+    struct RasterBox box = { true, 1, { 0, 0, TEST_TEXT_FB_WIDTH, TEST_TEXT_FB_HEIGHT }, { .argb = 0xFF203040 }, &label };
+    struct Framebuffer fb;
+    struct RasterHandler hras;
+    framebuffer_api_init(&fb, blended, TEST_TEXT_FB_WIDTH, TEST_TEXT_FB_HEIGHT, 0, FRAMEBUFFER_ARGB8888);
+    raster_api_init(&hras, &box, 1, NULL, NULL, NULL);
+    framebuffer_api_bind(&hras, &fb);
+    raster_api_render(&hras);
+
+    framebuffer_api_init(&fb, opaque_pixels, TEST_TEXT_FB_WIDTH, TEST_TEXT_FB_HEIGHT, 0, FRAMEBUFFER_ARGB8888);
+    box.label = &opaque;
+    box.updated = true;
+    raster_api_set_opaque_text(&hras, true);
+    raster_api_render(&hras);
+
+    uint32_t text_pixels = 0;
+    for (uint32_t i = 0; i < TEST_TEXT_FB_WIDTH * TEST_TEXT_FB_HEIGHT; i++)
+        text_pixels += blended[i] != box.color.argb;
+    TEST_ASSERT_GREATER_THAN(0, text_pixels);
+    TEST_ASSERT_EQUAL_MEMORY(blended, opaque_pixels, sizeof(blended));
+}
+
+#define TEST_DIFF_FB_WIDTH (120)
+#define TEST_DIFF_FB_HEIGHT (60)
+
+// Renders a label at a value, then at another one, drawn again in full if fresh
+static void render_label_values(uint32_t *pixels, int32_t first, int32_t second, uint16_t size, bool fresh) {
+    struct RasterLabel label;
+    raster_api_create_label(&label,
+                            (union RasterLabelData){ .int_val = first },
+                            LABEL_DATA_INT,
+                            (union RasterLabelFormat){ .int_fmt = raster_api_int_format(false) },
+                            (struct RasterCoords){ 3, 2 },
+                            0,
+                            size,
+                            FONT_ALIGN_LEFT,
+                            (struct Color){ .argb = 0xFFF0C020 });
+    struct RasterBox box = { true, 1, { 2, 2, TEST_DIFF_FB_WIDTH - 4, TEST_DIFF_FB_HEIGHT - 4 }, { .argb = 0xFF203040 }, &label };
+    struct Framebuffer fb;
+    struct RasterHandler hras;
+    framebuffer_api_init(&fb, pixels, TEST_DIFF_FB_WIDTH, TEST_DIFF_FB_HEIGHT, 0, FRAMEBUFFER_ARGB8888);
+    memset(pixels, 0, TEST_DIFF_FB_WIDTH * TEST_DIFF_FB_HEIGHT * sizeof(pixels[0]));
+    raster_api_init(&hras, &box, 1, NULL, NULL, NULL);
+    framebuffer_api_bind(&hras, &fb);
+    raster_api_render(&hras);
+    if (fresh)
+        memset(pixels, 0, TEST_DIFF_FB_WIDTH * TEST_DIFF_FB_HEIGHT * sizeof(pixels[0]));
+    raster_api_set_label_data(&box, (union RasterLabelData){ .int_val = second });
+    if (fresh)
+        label.cache.valid = false;
+    raster_api_render(&hras);
+}
+
+void check_framebuffer_label_diff_matches_full() {
+    if (RASTER_PARTIAL == 0)
+        TEST_IGNORE_MESSAGE("Only boxes marked as updated are redrawn in partial mode");
+    static uint32_t diff[TEST_DIFF_FB_WIDTH * TEST_DIFF_FB_HEIGHT];
+    static uint32_t full[TEST_DIFF_FB_WIDTH * TEST_DIFF_FB_HEIGHT];
+    // Scaled down glyphs have runs widened to one pixel, which reach into the next cell
+    for (uint16_t size = 6; size <= 48; size++) {
+        for (int32_t value = 0; value < 60; value++) {
+            render_label_values(diff, value, value + 1, size, false);
+            render_label_values(full, value, value + 1, size, true);
+            TEST_ASSERT_EQUAL_MEMORY_MESSAGE(full, diff, sizeof(full), "Redrawn glyphs should match a full render");
+        }
+    }
+}
+
+#define TEST_TILE_FB_WIDTH (300)
+#define TEST_TILE_FB_HEIGHT (330)
+
+void check_framebuffer_parallel_matches_serial() {
+    static uint32_t serial[TEST_TILE_FB_WIDTH * TEST_TILE_FB_HEIGHT];
+    static uint32_t parallel[TEST_TILE_FB_WIDTH * TEST_TILE_FB_HEIGHT];
+    static uint16_t cells[128];
+    static uint16_t entries[128];
+    // Drawn at the generated size, so that no glyph run overlaps another
+    struct RasterLabel labels[3];
+    for (uint16_t i = 0; i < 3; i++) {
+        raster_api_create_label(&labels[i],
+                                (union RasterLabelData){ .int_val = 47 * (i + 1) },
+                                LABEL_DATA_INT,
+                                (union RasterLabelFormat){ .int_fmt = raster_api_int_format(false) },
+                                (struct RasterCoords){ 3, 5 },
+                                0,
+                                fonts[0].glyphs[0].height,
+                                FONT_ALIGN_LEFT,
+                                (struct Color){ .argb = 0xC0F0C020 });
+    }
+    struct RasterBox boxes[] = {
+        { true, 1, { 0, 0, 280, 160 }, { .argb = 0xFF203040 }, &labels[0] },
+        { true, 2, { 40, 100, 250, 150 }, { .argb = 0xFF402030 }, &labels[1] },
+        { true, 3, { 5, 170, 295, 160 }, { .argb = 0x80304020 }, &labels[2] }
+    };
+    struct Framebuffer fb;
+    struct RasterHandler hras;
+    framebuffer_api_init(&fb, serial, TEST_TILE_FB_WIDTH, TEST_TILE_FB_HEIGHT, 0, FRAMEBUFFER_ARGB8888);
+    memset(serial, 0, sizeof(serial));
+    raster_api_init(&hras, boxes, 3, NULL, NULL, NULL);
+    framebuffer_api_bind(&hras, &fb);
+    raster_api_render(&hras);
+
+    // Tiles not multiple of the screen size, binned through a grid
+    struct RasterGrid grid;
+    raster_api_grid_init(&grid, cells, 128, entries, 128, 6);
+    raster_api_set_grid(&hras, &grid);
+    struct RasterWorkers workers;
+    TEST_ASSERT_TRUE(raster_api_workers_init(&workers));
+    TEST_ASSERT_EQUAL_UINT16(RASTER_THREADS > 1 ? RASTER_THREADS - 1 : 0, workers.count);
+    raster_api_set_workers(&hras, &workers);
+    framebuffer_api_init(&fb, parallel, TEST_TILE_FB_WIDTH, TEST_TILE_FB_HEIGHT, 0, FRAMEBUFFER_ARGB8888);
+    memset(parallel, 0, sizeof(parallel));
+    for (uint16_t i = 0; i < 3; i++)
+        boxes[i].updated = true;
+    struct RasterRect screen = { 0, 0, TEST_TILE_FB_WIDTH, TEST_TILE_FB_HEIGHT };
+    raster_api_render_parallel(&hras, &screen, 37, 23);
+
+    TEST_ASSERT_EQUAL_MEMORY(serial, parallel, sizeof(serial));
+    for (uint16_t i = 0; i < 3; i++)
+        TEST_ASSERT_FALSE(boxes[i].updated);
+
+    // Only the tiles of the changed label are drawn again
+    memset(parallel, 0, sizeof(parallel));
+    raster_api_set_label_data(&boxes[0], (union RasterLabelData){ .int_val = 9 });
+    raster_api_render_parallel(&hras, &screen, 37, 23);
+    TEST_ASSERT_EQUAL_HEX32(0xFF203040, parallel[0]);
+    if (RASTER_PARTIAL != 0)
+        TEST_ASSERT_EQUAL_HEX32(0, parallel[(TEST_TILE_FB_HEIGHT - 1) * TEST_TILE_FB_WIDTH]);
+
+    // The same workers draw every frame
+    for (int32_t value = 10; value < 40; value++) {
+        raster_api_set_label_data(&boxes[0], (union RasterLabelData){ .int_val = value });
+        raster_api_render_parallel(&hras, &screen, 37, 23);
+    }
+    TEST_ASSERT_FALSE(boxes[0].updated);
+    raster_api_workers_destroy(&workers);
+    TEST_ASSERT_EQUAL_UINT16(0, workers.count);
+}
@@ -20,6 +20,28 @@ void check_font_length_empty_string(void);
 void check_font_length_single_char(void);
 void check_font_length_longer_text(void);
 void check_font_length_different_sizes(void);
+void check_font_scaled_metrics_match_float(void);
+void check_find_glyph_index(void);
+void check_font_draw_spans_matches_lines(void);
+void check_font_draw_rectangles_matches_lines(void);
+void check_font_layout_matches_length(void);
+void check_font_draw_layout_matches_draw(void);
+void check_font_clip_restricts_pixels(void);
+void check_font_align_does_not_wrap(void);
+void check_font_clip_skips_outside_glyphs(void);
+void check_font_palette_emits_opaque_colors(void);
+void check_font_glyph_cache_matches_decode(void);
+void check_font_glyph_cache_evicts_least_recent(void);
+void check_font_merge_many_runs_per_row(void);
+void check_font_uses_smallest_fitting_level(void);
+void check_font_row_table_is_consistent(void);
+void check_font_rows_match_stream(void);
+void check_font_sdf_scales_up_sharp(void);
+void check_font_sdf_clip_and_cache_match_lines(void);
+void check_font_pack_matches_generated(void);
+void check_font_pack_rejects_invalid(void);
+void check_font_pack_loads_generator_output(void);
+void check_font_unknown_is_ignored(void);
 
 // libraster tests declarations
 void check_get_box_found(void);
@@ -33,10 +55,43 @@ void check_label_string_type(void);
 void check_get_box_with_multiple_boxes(void);
 void check_get_box_first_element(void);
 void check_get_box_last_element(void);
+void check_find_box_with_index(void);
+void check_find_box_without_index(void);
 void check_set_label_data_float(void);
 void check_set_label_data_string(void);
 void check_set_label_data_null_box(void);
 void check_box_with_label_properties(void);
+void check_damage_merges_adjacent_boxes(void);
+void check_damage_skips_unchanged_boxes(void);
+void check_damage_bounded_list(void);
+void check_set_label_data_same_precision_is_noop(void);
+void check_set_label_format_marks_updated(void);
+void check_apply_updates_last_value_wins(void);
+void check_queue_rejects_when_full(void);
+void check_render_drains_queue(void);
+void check_queue_concurrent_producer(void);
+void check_render_region_clips_to_band(void);
+void check_render_clips_text_to_box(void);
+void check_render_skips_occluded_boxes(void);
+void check_render_redraws_boxes_above(void);
+void check_render_redraws_label_above_completely(void);
+void check_grid_queries_match_linear_scan(void);
+void check_grid_too_small_falls_back(void);
+void check_render_caches_label_layout(void);
+void check_render_redraws_changed_glyphs_only(void);
+void check_format_int_matches_snprintf(void);
+void check_format_float_matches_snprintf(void);
+void check_format_truncates_like_snprintf(void);
+
+// framebuffer tests declarations
+void check_framebuffer_fill_opaque(void);
+void check_framebuffer_blend_matches_reference(void);
+void check_framebuffer_rgb565_blend_matches_reference(void);
+void check_framebuffer_rgb565_and_l8(void);
+void check_framebuffer_bind_renders(void);
+void check_framebuffer_opaque_text_matches_blending(void);
+void check_framebuffer_label_diff_matches_full(void);
+void check_framebuffer_parallel_matches_serial(void);
 
 int main(void) {
     UNITY_BEGIN();
@@ -55,6 +110,34 @@ int main(void) {
     RUN_TEST(check_font_length_single_char);
     RUN_TEST(check_font_length_longer_text);
     RUN_TEST(check_font_length_different_sizes);
+    RUN_TEST(check_font_scaled_metrics_match_float);
+    RUN_TEST(check_find_glyph_index);
+
+    // fontutils tests - batched output
+    RUN_TEST(check_font_draw_spans_matches_lines);
+    RUN_TEST(check_font_draw_rectangles_matches_lines);
+
+    // fontutils tests - text layout
+    RUN_TEST(check_font_layout_matches_length);
+    RUN_TEST(check_font_draw_layout_matches_draw);
+    RUN_TEST(check_font_clip_restricts_pixels);
+    RUN_TEST(check_font_align_does_not_wrap);
+    RUN_TEST(check_font_clip_skips_outside_glyphs);
+    RUN_TEST(check_font_palette_emits_opaque_colors);
+    RUN_TEST(check_font_glyph_cache_matches_decode);
+    RUN_TEST(check_font_glyph_cache_evicts_least_recent);
+    RUN_TEST(check_font_merge_many_runs_per_row);
+    RUN_TEST(check_font_uses_smallest_fitting_level);
+    RUN_TEST(check_font_row_table_is_consistent);
+    RUN_TEST(check_font_rows_match_stream);
+    RUN_TEST(check_font_sdf_scales_up_sharp);
+    RUN_TEST(check_font_sdf_clip_and_cache_match_lines);
+
+    // fontutils tests - font packs
+    RUN_TEST(check_font_pack_matches_generated);
+    RUN_TEST(check_font_pack_rejects_invalid);
+    RUN_TEST(check_font_pack_loads_generator_output);
+    RUN_TEST(check_font_unknown_is_ignored);
 
     // raster tests - basic box operations
     RUN_TEST(check_get_box_found);
@@ -62,6 +145,8 @@ int main(void) {
     RUN_TEST(check_get_box_with_multiple_boxes);
     RUN_TEST(check_get_box_first_element);
     RUN_TEST(check_get_box_last_element);
+    RUN_TEST(check_find_box_with_index);
+    RUN_TEST(check_find_box_without_index);
 
     // libraster tests - label creation and data types
     RUN_TEST(check_label_building);
@@ -76,6 +161,41 @@ int main(void) {
     RUN_TEST(check_set_label_data_float);
     RUN_TEST(check_set_label_data_string);
     RUN_TEST(check_set_label_data_null_box);
+    RUN_TEST(check_set_label_data_same_precision_is_noop);
+    RUN_TEST(check_set_label_format_marks_updated);
+    RUN_TEST(check_apply_updates_last_value_wins);
+    RUN_TEST(check_queue_rejects_when_full);
+    RUN_TEST(check_render_drains_queue);
+    RUN_TEST(check_queue_concurrent_producer);
+    RUN_TEST(check_render_region_clips_to_band);
+    RUN_TEST(check_render_clips_text_to_box);
+    RUN_TEST(check_render_skips_occluded_boxes);
+    RUN_TEST(check_render_redraws_boxes_above);
+    RUN_TEST(check_render_redraws_label_above_completely);
+    RUN_TEST(check_grid_queries_match_linear_scan);
+    RUN_TEST(check_grid_too_small_falls_back);
+    RUN_TEST(check_render_caches_label_layout);
+    RUN_TEST(check_render_redraws_changed_glyphs_only);
+
+    // libraster tests - number formatting
+    RUN_TEST(check_format_int_matches_snprintf);
+    RUN_TEST(check_format_float_matches_snprintf);
+    RUN_TEST(check_format_truncates_like_snprintf);
+
+    // libraster tests - damage tracking
+    RUN_TEST(check_damage_merges_adjacent_boxes);
+    RUN_TEST(check_damage_skips_unchanged_boxes);
+    RUN_TEST(check_damage_bounded_list);
+
+    // framebuffer tests - software backend
+    RUN_TEST(check_framebuffer_fill_opaque);
+    RUN_TEST(check_framebuffer_blend_matches_reference);
+    RUN_TEST(check_framebuffer_rgb565_blend_matches_reference);
+    RUN_TEST(check_framebuffer_rgb565_and_l8);
+    RUN_TEST(check_framebuffer_bind_renders);
+    RUN_TEST(check_framebuffer_opaque_text_matches_blending);
+    RUN_TEST(check_framebuffer_label_diff_matches_full);
+    RUN_TEST(check_framebuffer_parallel_matches_serial);
 
     return UNITY_END();
 }
@@ -7,8 +7,15 @@
  */
 
 #include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
 #include "unity.h"
 #include "raster-api.h"
+#include "fontutils-api.h"
+#if RASTER_THREADS > 0
+#include <pthread.h>
+#endif
 
 void check_get_box_found() {
     struct RasterBox boxes[] = {
@@ -236,3 +243,673 @@ void check_box_with_label_properties() {
     TEST_ASSERT_EQUAL_MESSAGE(FONT_ALIGN_LEFT, l.align, "Label alignment does not match");
     TEST_ASSERT_EQUAL_UINT32_MESSAGE(0xFFABCDEF, l.color.argb, "Label color does not match");
 }
+
+static void stub_draw_line(uint16_t x, uint16_t y, uint16_t lenght, struct Color color) {
+    (void)x;
+    (void)y;
+    (void)lenght;
+    (void)color;
+}
+
+static void stub_draw_rectangle(uint16_t x, uint16_t y, uint16_t w, uint16_t h, struct Color color) {
+    (void)x;
+    (void)y;
+    (void)w;
+    (void)h;
+    (void)color;
+}
+
+void check_damage_merges_adjacent_boxes() {
+    if (RASTER_PARTIAL == 0)
+        TEST_IGNORE_MESSAGE("Only boxes marked as updated are redrawn in partial mode");
+    struct RasterBox boxes[] = {
+        { true, 0x1, { 0, 0, 50, 50 }, { .argb = 0xFF000000 }, NULL },
+        { true, 0x2, { 50, 0, 50, 50 }, { .argb = 0xFF000000 }, NULL },
+        { true, 0x3, { 200, 200, 10, 10 }, { .argb = 0xFF000000 }, NULL }
+    };
+    struct RasterHandler hras;
+    raster_api_init(&hras, boxes, 3, stub_draw_line, stub_draw_rectangle, NULL);
+    raster_api_render(&hras);
+
+    const struct RasterRect *rects;
+    uint16_t count;
+    TEST_ASSERT_TRUE(raster_api_get_damage(&hras, &rects, &count));
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(2, count, "Adjacent boxes should be merged");
+    TEST_ASSERT_EQUAL_UINT16(100, rects[0].w);
+    TEST_ASSERT_EQUAL_UINT16(50, rects[0].h);
+    TEST_ASSERT_EQUAL_UINT16(200, rects[1].x);
+}
+
+void check_damage_skips_unchanged_boxes() {
+    if (RASTER_PARTIAL == 0)
+        TEST_IGNORE_MESSAGE("Only boxes marked as updated are redrawn in partial mode");
+    struct RasterBox boxes[] = {
+        { false, 0x1, { 0, 0, 50, 50 }, { .argb = 0xFF000000 }, NULL },
+        { true, 0x2, { 100, 100, 20, 20 }, { .argb = 0xFF000000 }, NULL }
+    };
+    struct RasterHandler hras;
+    raster_api_init(&hras, boxes, 2, stub_draw_line, stub_draw_rectangle, NULL);
+    raster_api_render(&hras);
+
+    const struct RasterRect *rects;
+    uint16_t count;
+    raster_api_get_damage(&hras, &rects, &count);
+    TEST_ASSERT_EQUAL_UINT16(1, count);
+    TEST_ASSERT_EQUAL_UINT16(100, rects[0].x);
+    TEST_ASSERT_EQUAL_UINT16(20, rects[0].w);
+}
+
+void check_damage_bounded_list() {
+    struct RasterBox boxes[RASTER_MAX_DAMAGE_RECTS + 4];
+    for (int i = 0; i < RASTER_MAX_DAMAGE_RECTS + 4; i++) {
+        boxes[i] = (struct RasterBox){ true, i, { i * 20, 0, 10, 10 }, { .argb = 0xFF000000 }, NULL };
+    }
+    struct RasterHandler hras;
+    raster_api_init(&hras, boxes, RASTER_MAX_DAMAGE_RECTS + 4, stub_draw_line, stub_draw_rectangle, NULL);
+    raster_api_render(&hras);
+
+    const struct RasterRect *rects;
+    uint16_t count;
+    raster_api_get_damage(&hras, &rects, &count);
+    TEST_ASSERT_LESS_OR_EQUAL(RASTER_MAX_DAMAGE_RECTS, count);
+    for (int i = 0; i < RASTER_MAX_DAMAGE_RECTS + 4; i++) {
+        bool covered = false;
+        for (int j = 0; j < count; j++) {
+            if (rects[j].x <= boxes[i].rect.x && rects[j].x + rects[j].w >= boxes[i].rect.x + boxes[i].rect.w)
+                covered = true;
+        }
+        TEST_ASSERT_TRUE_MESSAGE(covered, "Every redrawn box must be covered by the damage list");
+    }
+}
+
+void check_set_label_data_same_precision_is_noop() {
+    struct RasterLabel l;
+    raster_api_create_label(&l,
+                            (union RasterLabelData){ .float_val = 12.341f },
+                            LABEL_DATA_FLOAT,
+                            (union RasterLabelFormat){ .float_fmt = raster_api_float_format(2) },
+                            (struct RasterCoords){ 0, 0 },
+                            0,
+                            10,
+                            FONT_ALIGN_LEFT,
+                            (struct Color){ .argb = 0xFFFFFFFF });
+    struct RasterBox box = { true, 0x1, { 0, 0, 100, 100 }, { .argb = 0xFF000000 }, &l };
+    struct RasterHandler hras;
+    raster_api_init(&hras, &box, 1, stub_draw_line, stub_draw_rectangle, NULL);
+    raster_api_render(&hras);
+    TEST_ASSERT_FALSE_MESSAGE(box.updated, "Render should clear the updated flag");
+
+    raster_api_set_label_data(&box, (union RasterLabelData){ .float_val = 12.344f });
+    TEST_ASSERT_FALSE_MESSAGE(box.updated, "Change below precision should not mark the box");
+
+    raster_api_set_label_data(&box, (union RasterLabelData){ .float_val = 12.36f });
+    TEST_ASSERT_TRUE_MESSAGE(box.updated, "Visible change should mark the box");
+}
+
+void check_set_label_format_marks_updated() {
+    struct RasterLabel l;
+    raster_api_create_label(&l,
+                            (union RasterLabelData){ .float_val = 1.5f },
+                            LABEL_DATA_FLOAT,
+                            (union RasterLabelFormat){ .float_fmt = raster_api_float_format(1) },
+                            (struct RasterCoords){ 0, 0 },
+                            0,
+                            10,
+                            FONT_ALIGN_LEFT,
+                            (struct Color){ .argb = 0xFFFFFFFF });
+    struct RasterBox box = { true, 0x1, { 0, 0, 100, 100 }, { .argb = 0xFF000000 }, &l };
+    struct RasterHandler hras;
+    raster_api_init(&hras, &box, 1, stub_draw_line, stub_draw_rectangle, NULL);
+    raster_api_render(&hras);
+
+    raster_api_set_label_format(&box, (union RasterLabelFormat){ .float_fmt = raster_api_float_format(1) });
+    TEST_ASSERT_FALSE(box.updated);
+
+    raster_api_set_label_format(&box, (union RasterLabelFormat){ .float_fmt = raster_api_float_format(2) });
+    TEST_ASSERT_TRUE(box.updated);
+}
+
+void check_render_caches_label_layout() {
+    struct RasterLabel l;
+    raster_api_create_label(&l,
+                            (union RasterLabelData){ .int_val = 123 },
+                            LABEL_DATA_INT,
+                            (union RasterLabelFormat){ .int_fmt = raster_api_int_format(false) },
+                            (struct RasterCoords){ 50, 0 },
+                            0,
+                            20,
+                            FONT_ALIGN_CENTER,
+                            (struct Color){ .argb = 0xFFFFFFFF });
+    struct RasterBox box = { true, 0x1, { 0, 0, 100, 100 }, { .argb = 0xFF000000 }, &l };
+    struct RasterHandler hras;
+    raster_api_init(&hras, &box, 1, stub_draw_line, stub_draw_rectangle, NULL);
+    raster_api_render(&hras);
+
+    TEST_ASSERT_TRUE(l.cache.valid);
+    TEST_ASSERT_EQUAL_STRING("123", l.cache.text);
+    TEST_ASSERT_EQUAL_UINT16(3, l.cache.layout.count);
+    TEST_ASSERT_EQUAL_UINT16(font_api_length("123", 20, 0), l.cache.layout.width);
+}
+
+static void format_number(union RasterLabelData data, enum RasterLabelDataType type, union RasterLabelFormat format, char *buffer, size_t size) {
+    struct RasterLabel l;
+    raster_api_create_label(&l, data, type, format, (struct RasterCoords){ 0, 0 }, 0, 10, FONT_ALIGN_LEFT, (struct Color){ .argb = 0xFFFFFFFF });
+    raster_api_format_label(&l, buffer, size);
+}
+
+void check_format_int_matches_snprintf() {
+    char expected[32];
+    char actual[32];
+    uint32_t seed = 12345;
+    int32_t edge[] = { 0, 1, -1, 9, 10, 99, 100, -100, 65535, INT32_MAX, INT32_MIN };
+
+    for (int i = 0; i < 20000; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        int32_t value = i < (int)(sizeof(edge) / sizeof(edge[0])) ? edge[i] : (int32_t)(seed >> (i % 31));
+        bool is_unsigned = i & 1;
+
+        if (is_unsigned)
+            snprintf(expected, sizeof(expected), "%" PRIu32, (uint32_t)value);
+        else
+            snprintf(expected, sizeof(expected), "%" PRId32, value);
+        format_number((union RasterLabelData){ .int_val = value },
+                      LABEL_DATA_INT,
+                      (union RasterLabelFormat){ .int_fmt = raster_api_int_format(is_unsigned) },
+                      actual,
+                      sizeof(actual));
+        TEST_ASSERT_EQUAL_STRING(expected, actual);
+    }
+}
+
+void check_format_float_matches_snprintf() {
+    char expected[64];
+    char actual[64];
+    uint32_t seed = 54321;
+    float edge[] = { 0.0f, -0.0f, 0.5f, 1.5f, 2.5f, 0.125f, 0.375f, -0.001f, 9.9999f, 12.344f, 3.4028235e38f, 1e-45f, 16777216.0f, 4294967296.0f };
+
+    for (int i = 0; i < 100000; i++) {
+        float value;
+        seed = seed * 1664525u + 1013904223u;
+        if (i < (int)(sizeof(edge) / sizeof(edge[0]))) {
+            value = edge[i];
+        } else {
+            // Random bit patterns concentrated around the usual dashboard range
+            uint32_t bits = (seed & 0x807fffff) | ((uint32_t)(110 + (seed >> 8) % 50) << 23);
+            if (i % 16 == 0)
+                bits = seed;
+            memcpy(&value, &bits, sizeof(value));
+        }
+        if (value != value)
+            continue;
+        uint8_t precision = i % (RASTER_MAX_FLOAT_PRECISION + 1);
+
+        snprintf(expected, sizeof(expected), "%.*f", precision, value);
+        format_number((union RasterLabelData){ .float_val = value },
+                      LABEL_DATA_FLOAT,
+                      (union RasterLabelFormat){ .float_fmt = raster_api_float_format(precision) },
+                      actual,
+                      sizeof(actual));
+        TEST_ASSERT_EQUAL_STRING(expected, actual);
+    }
+}
+
+void check_format_truncates_like_snprintf() {
+    char actual[5];
+    format_number((union RasterLabelData){ .float_val = 1234.5678f },
+                  LABEL_DATA_FLOAT,
+                  (union RasterLabelFormat){ .float_fmt = raster_api_float_format(3) },
+                  actual,
+                  sizeof(actual));
+    TEST_ASSERT_EQUAL_STRING("1234", actual);
+}
+
+static uint32_t rect_calls;
+static struct RasterRect last_rect;
+
+static void record_draw_rectangle(uint16_t x, uint16_t y, uint16_t w, uint16_t h, struct Color color) {
+    (void)color;
+    rect_calls++;
+    last_rect = (struct RasterRect){ x, y, w, h };
+}
+
+void check_render_redraws_changed_glyphs_only() {
+    if (RASTER_PARTIAL == 0)
+        TEST_IGNORE_MESSAGE("Only boxes marked as updated are redrawn in partial mode");
+    // '3' and '6' have the same width, '1' is narrower
+    struct RasterLabel l;
+    raster_api_create_label(&l,
+                            (union RasterLabelData){ .int_val = 83 },
+                            LABEL_DATA_INT,
+                            (union RasterLabelFormat){ .int_fmt = raster_api_int_format(false) },
+                            (struct RasterCoords){ 100, 10 },
+                            0,
+                            40,
+                            FONT_ALIGN_CENTER,
+                            (struct Color){ .argb = 0xFFFFFFFF });
+    struct RasterBox box = { true, 0x1, { 0, 0, 200, 60 }, { .argb = 0xFF000000 }, &l };
+    struct RasterHandler hras;
+    raster_api_init(&hras, &box, 1, stub_draw_line, record_draw_rectangle, NULL);
+    raster_api_render(&hras);
+    TEST_ASSERT_EQUAL_UINT32(1, rect_calls);
+
+    rect_calls = 0;
+    raster_api_set_label_data(&box, (union RasterLabelData){ .int_val = 86 });
+    raster_api_render(&hras);
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(1, rect_calls, "Only the changed glyph cell should be cleared");
+    TEST_ASSERT_LESS_THAN_MESSAGE(box.rect.w / 2, last_rect.w, "Cleared cell should be a single glyph");
+    TEST_ASSERT_GREATER_OR_EQUAL(100, last_rect.x);
+
+    const struct RasterRect *rects;
+    uint16_t count;
+    raster_api_get_damage(&hras, &rects, &count);
+    TEST_ASSERT_EQUAL_UINT16(1, count);
+    TEST_ASSERT_EQUAL_UINT16(last_rect.w, rects[0].w);
+
+    rect_calls = 0;
+    raster_api_set_label_data(&box, (union RasterLabelData){ .int_val = 81 });
+    raster_api_render(&hras);
+    TEST_ASSERT_EQUAL_UINT32(1, rect_calls);
+    TEST_ASSERT_EQUAL_UINT16_MESSAGE(box.rect.w, last_rect.w, "Layout change should redraw the whole box");
+}
+
+void check_find_box_with_index() {
+    struct RasterBox boxes[] = {
+        { true, 0x30, { 0, 0, 10, 10 }, { .argb = 0xFF000000 }, NULL },
+        { true, 0x10, { 10, 0, 10, 10 }, { .argb = 0xFF000000 }, NULL },
+        { true, 0x50, { 20, 0, 10, 10 }, { .argb = 0xFF000000 }, NULL },
+        { true, 0x20, { 30, 0, 10, 10 }, { .argb = 0xFF000000 }, NULL }
+    };
+    uint16_t index[4];
+    struct RasterHandler hras;
+    raster_api_init(&hras, boxes, 4, stub_draw_line, stub_draw_rectangle, NULL);
+    raster_api_set_index(&hras, index, 4);
+
+    TEST_ASSERT_TRUE(hras.index_valid);
+    for (int i = 0; i < 4; i++)
+        TEST_ASSERT_EQUAL_PTR(&boxes[i], raster_api_find_box(&hras, boxes[i].id));
+    TEST_ASSERT_NULL(raster_api_find_box(&hras, 0x40));
+    TEST_ASSERT_NULL(raster_api_find_box(&hras, 0x60));
+
+    raster_api_set_interface(&hras, boxes, 2);
+    TEST_ASSERT_NULL_MESSAGE(raster_api_find_box(&hras, 0x50), "Index should be rebuilt with the interface");
+    TEST_ASSERT_EQUAL_PTR(&boxes[1], raster_api_find_box(&hras, 0x10));
+}
+
+void check_find_box_without_index() {
+    struct RasterBox boxes[] = {
+        { true, 0x30, { 0, 0, 10, 10 }, { .argb = 0xFF000000 }, NULL },
+        { true, 0x10, { 10, 0, 10, 10 }, { .argb = 0xFF000000 }, NULL },
+        { true, 0x50, { 20, 0, 10, 10 }, { .argb = 0xFF000000 }, NULL }
+    };
+    uint16_t index[2];
+    struct RasterHandler hras;
+    raster_api_init(&hras, boxes, 3, stub_draw_line, stub_draw_rectangle, NULL);
+    raster_api_set_index(&hras, index, 2);
+
+    TEST_ASSERT_FALSE_MESSAGE(hras.index_valid, "Index too small should not be used");
+    TEST_ASSERT_EQUAL_PTR(&boxes[2], raster_api_find_box(&hras, 0x50));
+}
+
+void check_apply_updates_last_value_wins() {
+    struct RasterLabel labels[3];
+    for (int i = 0; i < 3; i++) {
+        raster_api_create_label(&labels[i],
+                                (union RasterLabelData){ .int_val = 0 },
+                                LABEL_DATA_INT,
+                                (union RasterLabelFormat){ .int_fmt = raster_api_int_format(false) },
+                                (struct RasterCoords){ 0, 0 },
+                                0,
+                                10,
+                                FONT_ALIGN_LEFT,
+                                (struct Color){ .argb = 0xFFFFFFFF });
+    }
+    struct RasterBox boxes[] = {
+        { true, 0x30, { 0, 0, 10, 10 }, { .argb = 0xFF000000 }, &labels[0] },
+        { true, 0x10, { 10, 0, 10, 10 }, { .argb = 0xFF000000 }, &labels[1] },
+        { true, 0x20, { 20, 0, 10, 10 }, { .argb = 0xFF000000 }, &labels[2] }
+    };
+    uint16_t index[3];
+    struct RasterHandler hras;
+    raster_api_init(&hras, boxes, 3, stub_draw_line, stub_draw_rectangle, NULL);
+    raster_api_set_index(&hras, index, 3);
+    raster_api_render(&hras);
+
+    struct RasterUpdate updates[] = {
+        { 0x30, { .int_val = 1 } },
+        { 0x10, { .int_val = 0 } },
+        { 0x99, { .int_val = 5 } },
+        { 0x30, { .int_val = 2 } },
+        { 0x30, { .int_val = 3 } }
+    };
+    uint16_t applied = raster_api_apply_updates(&hras, updates, 5);
+
+    TEST_ASSERT_EQUAL_UINT16(2, applied);
+    TEST_ASSERT_EQUAL_INT32(3, labels[0].data.int_val);
+    TEST_ASSERT_TRUE(boxes[0].updated);
+    TEST_ASSERT_FALSE_MESSAGE(boxes[1].updated, "Unchanged value should not mark the box");
+    TEST_ASSERT_FALSE(boxes[2].updated);
+}
+
+void check_queue_rejects_when_full() {
+    struct RasterUpdate storage[4];
+    struct RasterUpdateQueue queue;
+
+    TEST_ASSERT_FALSE(raster_api_queue_init(&queue, storage, 3));
+    TEST_ASSERT_TRUE(raster_api_queue_init(&queue, storage, 4));
+    for (int i = 0; i < 4; i++)
+        TEST_ASSERT_TRUE(raster_api_queue_push(&queue, 1, (union RasterLabelData){ .int_val = i }));
+    TEST_ASSERT_FALSE(raster_api_queue_push(&queue, 1, (union RasterLabelData){ .int_val = 4 }));
+}
+
+void check_render_drains_queue() {
+    struct RasterLabel label;
+    raster_api_create_label(&label,
+                            (union RasterLabelData){ .int_val = 0 },
+                            LABEL_DATA_INT,
+                            (union RasterLabelFormat){ .int_fmt = raster_api_int_format(false) },
+                            (struct RasterCoords){ 0, 0 },
+                            0,
+                            10,
+                            FONT_ALIGN_LEFT,
+                            (struct Color){ .argb = 0xFFFFFFFF });
+    struct RasterBox box = { true, 0x42, { 0, 0, 10, 10 }, { .argb = 0xFF000000 }, &label };
+    struct RasterHandler hras;
+    raster_api_init(&hras, &box, 1, stub_draw_line, stub_draw_rectangle, NULL);
+    raster_api_render(&hras);
+
+    struct RasterUpdate storage[2];
+    struct RasterUpdateQueue queue;
+    raster_api_queue_init(&queue, storage, 2);
+    raster_api_set_update_queue(&hras, &queue);
+
+    // Wrap around the ring a few times
+    for (int i = 1; i <= 5; i++) {
+        raster_api_queue_push(&queue, 0x42, (union RasterLabelData){ .int_val = i });
+        raster_api_queue_push(&queue, 0x42, (union RasterLabelData){ .int_val = i * 10 });
+        raster_api_render(&hras);
+        TEST_ASSERT_EQUAL_INT32(i * 10, label.data.int_val);
+        TEST_ASSERT_FALSE(box.updated);
+    }
+}
+
+#if RASTER_THREADS > 0
+#define TEST_QUEUE_UPDATES (20000)
+
+static void *queue_producer(void *arg) {
+    struct RasterUpdateQueue *queue = arg;
+    for (int i = 1; i <= TEST_QUEUE_UPDATES; i++)
+        while (!raster_api_queue_push(queue, 0x42, (union RasterLabelData){ .int_val = i }))
+            ;
+    return NULL;
+}
+#endif
+
+void check_queue_concurrent_producer() {
+#if RASTER_THREADS > 0
+    struct RasterLabel label;
+    raster_api_create_label(&label,
+                            (union RasterLabelData){ .int_val = 0 },
+                            LABEL_DATA_INT,
+                            (union RasterLabelFormat){ .int_fmt = raster_api_int_format(false) },
+                            (struct RasterCoords){ 0, 0 },
+                            0,
+                            10,
+                            FONT_ALIGN_LEFT,
+                            (struct Color){ .argb = 0xFFFFFFFF });
+    struct RasterBox box = { true, 0x42, { 0, 0, 10, 10 }, { .argb = 0xFF000000 }, &label };
+    struct RasterHandler hras;
+    raster_api_init(&hras, &box, 1, stub_draw_line, stub_draw_rectangle, NULL);
+
+    struct RasterUpdate storage[8];
+    struct RasterUpdateQueue queue;
+    raster_api_queue_init(&queue, storage, 8);
+    pthread_t producer;
+    TEST_ASSERT_EQUAL_INT(0, pthread_create(&producer, NULL, queue_producer, &queue));
+
+    // Every drained value was fully written, and values never go back
+    int32_t last = 0;
+    while (last < TEST_QUEUE_UPDATES) {
+        raster_api_queue_drain(&hras, &queue);
+        TEST_ASSERT_GREATER_OR_EQUAL_INT32(last, label.data.int_val);
+        TEST_ASSERT_LESS_OR_EQUAL_INT32(TEST_QUEUE_UPDATES, label.data.int_val);
+        last = label.data.int_val;
+    }
+    pthread_join(producer, NULL);
+#else
+    TEST_IGNORE_MESSAGE("The producer thread needs RASTER_THREADS");
+#endif
+}
+
+static struct RasterRect region_bounds;
+static bool region_escaped;
+static uint32_t region_rects;
+
+static void region_check(uint32_t x0, uint32_t y0, uint32_t x1, uint32_t y1) {
+    if (x0 < region_bounds.x || y0 < region_bounds.y ||
+        x1 > (uint32_t)region_bounds.x + region_bounds.w || y1 > (uint32_t)region_bounds.y + region_bounds.h)
+        region_escaped = true;
+}
+
+static void region_draw_line(uint16_t x, uint16_t y, uint16_t lenght, struct Color color) {
+    (void)color;
+    region_check(x, y, (uint32_t)x + lenght, (uint32_t)y + 1);
+}
+
+static void region_draw_rectangle(uint16_t x, uint16_t y, uint16_t w, uint16_t h, struct Color color) {
+    (void)color;
+    region_rects++;
+    region_check(x, y, (uint32_t)x + w, (uint32_t)y + h);
+}
+
+void check_render_region_clips_to_band() {
+    struct RasterLabel label;
+    raster_api_create_label(&label,
+                            (union RasterLabelData){ .int_val = 88 },
+                            LABEL_DATA_INT,
+                            (union RasterLabelFormat){ .int_fmt = raster_api_int_format(false) },
+                            (struct RasterCoords){ 0, 0 },
+                            0,
+                            60,
+                            FONT_ALIGN_LEFT,
+                            (struct Color){ .argb = 0xFFFFFFFF });
+    struct RasterBox boxes[] = {
+        { true, 1, { 0, 0, 200, 60 }, { .argb = 0xFF000000 }, &label },
+        { true, 2, { 0, 100, 200, 20 }, { .argb = 0xFF000000 }, NULL }
+    };
+    struct RasterHandler hras;
+    raster_api_init(&hras, boxes, 2, region_draw_line, region_draw_rectangle, NULL);
+
+    region_bounds = (struct RasterRect){ 0, 20, 320, 20 };
+    region_escaped = false;
+    region_rects = 0;
+    raster_api_render_region(&hras, &region_bounds);
+
+    TEST_ASSERT_FALSE_MESSAGE(region_escaped, "Nothing should be drawn outside the region");
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(1, region_rects, "Boxes outside the region should be skipped");
+    TEST_ASSERT_TRUE_MESSAGE(boxes[0].updated, "Region rendering should not clear the updated flags");
+}
+
+void check_render_clips_text_to_box() {
+    struct RasterLabel label;
+    raster_api_create_label(&label,
+                            (union RasterLabelData){ .int_val = 88888 },
+                            LABEL_DATA_INT,
+                            (union RasterLabelFormat){ .int_fmt = raster_api_int_format(false) },
+                            (struct RasterCoords){ 20, 5 },
+                            0,
+                            60,
+                            FONT_ALIGN_CENTER,
+                            (struct Color){ .argb = 0xFFFFFFFF });
+    struct RasterBox box = { true, 1, { 30, 10, 80, 40 }, { .argb = 0xFF000000 }, &label };
+    struct RasterHandler hras;
+    raster_api_init(&hras, &box, 1, region_draw_line, region_draw_rectangle, NULL);
+
+    region_bounds = box.rect;
+    region_escaped = false;
+    raster_api_render(&hras);
+
+    TEST_ASSERT_FALSE_MESSAGE(region_escaped, "Text overflowing the box should be clipped");
+}
+
+static uint32_t color_rects[3];
+
+static void count_color_rectangle(uint16_t x, uint16_t y, uint16_t w, uint16_t h, struct Color color) {
+    (void)x;
+    (void)y;
+    (void)w;
+    (void)h;
+    color_rects[color.argb & 0x3]++;
+}
+
+void check_render_skips_occluded_boxes() {
+    struct RasterBox boxes[] = {
+        { true, 1, { 10, 10, 50, 50 }, { .argb = 0xFF000000 }, NULL },
+        { true, 2, { 0, 0, 100, 100 }, { .argb = 0xFF000001 }, NULL },
+        { true, 3, { 0, 0, 200, 200 }, { .argb = 0x80000002 }, NULL }
+    };
+    struct RasterHandler hras;
+    raster_api_init(&hras, boxes, 3, stub_draw_line, count_color_rectangle, NULL);
+    memset(color_rects, 0, sizeof(color_rects));
+
+    raster_api_render(&hras);
+
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, color_rects[0], "Box covered by an opaque box should be skipped");
+    TEST_ASSERT_FALSE_MESSAGE(boxes[0].updated, "Skipped box should not stay dirty");
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(1, color_rects[1], "Box covered by a translucent box should be drawn");
+    TEST_ASSERT_EQUAL_UINT32(1, color_rects[2]);
+
+    // Once uncovered and marked, the box is drawn again
+    boxes[1].rect.w = 5;
+    boxes[0].updated = true;
+    memset(color_rects, 0, sizeof(color_rects));
+    raster_api_render(&hras);
+    TEST_ASSERT_EQUAL_UINT32(1, color_rects[0]);
+    TEST_ASSERT_FALSE(boxes[0].updated);
+}
+
+void check_render_redraws_boxes_above() {
+    if (RASTER_PARTIAL == 0)
+        TEST_IGNORE_MESSAGE("Only boxes marked as updated are redrawn in partial mode");
+    struct RasterBox boxes[] = {
+        { true, 1, { 0, 0, 100, 100 }, { .argb = 0xFF000000 }, NULL },
+        { true, 2, { 90, 90, 20, 20 }, { .argb = 0xFF000001 }, NULL },
+        { true, 3, { 100, 0, 20, 20 }, { .argb = 0xFF000002 }, NULL }
+    };
+    struct RasterHandler hras;
+    raster_api_init(&hras, boxes, 3, stub_draw_line, count_color_rectangle, NULL);
+    raster_api_render(&hras);
+    memset(color_rects, 0, sizeof(color_rects));
+
+    boxes[0].updated = true;
+    raster_api_render(&hras);
+
+    TEST_ASSERT_EQUAL_UINT32(1, color_rects[0]);
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(1, color_rects[1], "Overlapping box above should be redrawn");
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, color_rects[2], "Adjacent box should not be redrawn");
+    TEST_ASSERT_FALSE(boxes[1].updated);
+}
+
+static uint32_t rect_hash;
+
+static void hash_draw_rectangle(uint16_t x, uint16_t y, uint16_t w, uint16_t h, struct Color color) {
+    // Depends on the order of the rectangles, as later ones stack on top
+    rect_hash = rect_hash * 31u + (((uint32_t)x << 16) ^ y ^ ((uint32_t)w << 20) ^ ((uint32_t)h << 8) ^ color.argb);
+}
+
+static uint32_t grid_seed = 12345;
+
+static uint16_t grid_random(uint16_t max) {
+    grid_seed = grid_seed * 1103515245u + 12345u;
+    return (uint16_t)((grid_seed >> 16) % max);
+}
+
+void check_grid_queries_match_linear_scan() {
+    static struct RasterBox boxes[200];
+    static uint16_t cells[32 * 32 + 1];
+    static uint16_t entries[4096];
+    for (uint16_t i = 0; i < 200; i++) {
+        boxes[i] = (struct RasterBox){ false, i, { grid_random(700), grid_random(400), grid_random(120), grid_random(80) }, { .argb = 0xFF000000 }, NULL };
+    }
+    struct RasterGrid grid;
+    struct RasterHandler hras;
+    raster_api_init(&hras, boxes, 200, stub_draw_line, stub_draw_rectangle, NULL);
+    raster_api_grid_init(&grid, cells, 32 * 32 + 1, entries, 4096, 5);
+    raster_api_set_grid(&hras, &grid);
+    TEST_ASSERT_TRUE(grid.valid);
+
+    uint16_t found[200];
+    uint16_t expected[200];
+    for (int q = 0; q < 200; q++) {
+        struct RasterRect rect = { grid_random(900), grid_random(500), grid_random(200), grid_random(200) };
+        hras.grid = &grid;
+        uint16_t count = raster_api_query_rect(&hras, &rect, found, 200);
+        struct RasterBox *hit = raster_api_box_at(&hras, rect.x, rect.y);
+        hras.grid = NULL;
+        TEST_ASSERT_EQUAL_UINT16(raster_api_query_rect(&hras, &rect, expected, 200), count);
+        TEST_ASSERT_EQUAL_MEMORY(expected, found, count * sizeof(found[0]));
+        TEST_ASSERT_EQUAL_PTR(raster_api_box_at(&hras, rect.x, rect.y), hit);
+    }
+
+    // Occlusion and redraw propagation must not depend on the grid
+    uint32_t drawn[2];
+    hras.draw_rectangle = hash_draw_rectangle;
+    for (int pass = 0; pass < 2; pass++) {
+        grid_seed = 777;
+        for (uint16_t i = 0; i < 200; i++) {
+            boxes[i].updated = grid_random(4) == 0;
+            boxes[i].color.a = grid_random(2) ? 0xFF : 0x80;
+        }
+        hras.grid = pass == 0 ? &grid : NULL;
+        rect_hash = 0;
+        raster_api_render(&hras);
+        drawn[pass] = rect_hash;
+    }
+    TEST_ASSERT_EQUAL_HEX32(drawn[0], drawn[1]);
+}
+
+void check_grid_too_small_falls_back() {
+    struct RasterBox boxes[] = {
+        { false, 1, { 0, 0, 100, 100 }, { .argb = 0xFF000000 }, NULL },
+        { false, 2, { 50, 50, 100, 100 }, { .argb = 0xFF000000 }, NULL }
+    };
+    uint16_t cells[4];
+    uint16_t entries[8];
+    struct RasterGrid grid;
+    struct RasterHandler hras;
+    raster_api_init(&hras, boxes, 2, stub_draw_line, stub_draw_rectangle, NULL);
+    raster_api_grid_init(&grid, cells, 4, entries, 8, 4);
+    raster_api_set_grid(&hras, &grid);
+
+    TEST_ASSERT_FALSE_MESSAGE(grid.valid, "Grid should not fit the storage");
+    TEST_ASSERT_EQUAL_PTR(&boxes[1], raster_api_box_at(&hras, 60, 60));
+    TEST_ASSERT_EQUAL_PTR(&boxes[0], raster_api_box_at(&hras, 10, 10));
+    TEST_ASSERT_NULL(raster_api_box_at(&hras, 200, 10));
+}
+
+void check_render_redraws_label_above_completely() {
+    struct RasterLabel label;
+    raster_api_create_label(&label,
+                            (union RasterLabelData){ .int_val = 83 },
+                            LABEL_DATA_INT,
+                            (union RasterLabelFormat){ .int_fmt = raster_api_int_format(false) },
+                            (struct RasterCoords){ 0, 0 },
+                            0,
+                            30,
+                            FONT_ALIGN_LEFT,
+                            (struct Color){ .argb = 0xFFFFFFFF });
+    struct RasterBox boxes[] = {
+        { true, 1, { 0, 0, 100, 100 }, { .argb = 0xFF000000 }, NULL },
+        { true, 2, { 50, 50, 100, 40 }, { .argb = 0xFF000001 }, &label }
+    };
+    struct RasterHandler hras;
+    raster_api_init(&hras, boxes, 2, stub_draw_line, count_color_rectangle, NULL);
+    raster_api_render(&hras);
+    memset(color_rects, 0, sizeof(color_rects));
+
+    // Same width digits: alone, the label would only redraw one glyph cell
+    boxes[0].updated = true;
+    raster_api_set_label_data(&boxes[1], (union RasterLabelData){ .int_val = 86 });
+    raster_api_render(&hras);
+
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(1, color_rects[1], "Overdrawn box should be redrawn completely");
+}
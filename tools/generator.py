@@ -1,4 +1,8 @@
 import os
+import re
+import struct
+import functools
+import hashlib
 from PIL import Image, ImageDraw, ImageFont
 import numpy as np
 from scipy.ndimage import distance_transform_edt
@@ -6,6 +10,7 @@ import json
 import datetime
 import argparse
 from pathlib import Path
+from concurrent.futures import ProcessPoolExecutor
 from jinja2 import Environment, FileSystemLoader
 import logging
 
@@ -13,10 +18,28 @@ import logging
 parser = argparse.ArgumentParser()
 parser.add_argument("--json", type=Path, default=Path(__file__).parent
                     / "fonts.json")
+parser.add_argument("--pack", type=Path,
+                    help="also write the fonts to this binary font pack")
+parser.add_argument("--jobs", type=int, default=os.cpu_count() or 1,
+                    help="number of processes rendering glyphs")
+parser.add_argument("--cache", type=Path,
+                    help="directory of the glyph cache, next to fonts.json "
+                    "by default")
+parser.add_argument("--no-cache", action="store_true",
+                    help="render every glyph, without reading or writing "
+                    "the glyph cache")
 args = parser.parse_args()
 
 
 SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+GLYPH_INDEX_NONE = 0xFF
+# Same order as enum FontFormat
+LAYOUTS = ("rle", "sdf", "rle_rows")
+PACK_MAGIC = b"LRFP"
+PACK_VERSION = 1
+PACK_NAME_SIZE = 16
+# Bump when the rendering or the encoding of glyphs changes
+GLYPH_CACHE_VERSION = 1
 json_base = args.json.parent
 
 
@@ -38,101 +61,373 @@ def compress_rle_4bit_paired(data):
                 count2 += 1
                 i += 1
         else:
+            sdf2 = 0
             count2 = 0
         compressed.append(((sdf1 << 4) | sdf2, count1, count2))
     return compressed
 
 
-def generate_bitmaps(fonts):
-    def smoothstep(edge0, edge1, x):
-        t = np.clip((x - edge0) / (edge1 - edge0), 0, 1)
-        return t * t * (3 - 2 * t)
+def compress_rle_rows(pixels, width, height):
+    """Compresses every row on its own, after a table of row offsets.
+
+    The table holds one 16 bits little endian offset per row, from the start
+    of the glyph data, so that any row can be decoded without the previous
+    ones. The table marks the end of the rows too, so transparent pixels at
+    the end of a row are left out.
+    """
+    rows = []
+    for y in range(height):
+        row = pixels[y * width:(y + 1) * width]
+        while row and row[-1] // 16 < 2:
+            row = row[:-1]
+        rows.append(compress_rle_4bit_paired(row))
+    table = []
+    data = []
+    offset = 2 * height
+    for row in rows:
+        table.extend((offset & 0xFF, offset >> 8))
+        encoded = [item for pair in row for item in pair]
+        data.extend(encoded)
+        offset += len(encoded)
+    return table + data
+
+
+def smoothstep(edge0, edge1, x):
+    t = np.clip((x - edge0) / (edge1 - edge0), 0, 1)
+    return t * t * (3 - 2 * t)
+
+
+def compute_sdf(bitmap, edge0, edge1, raw=False):
+    inside = distance_transform_edt(bitmap)
+    outside = distance_transform_edt(1 - bitmap)
+    sdf = inside - outside
+    normalized_sdf = np.clip((sdf + 3) / 6, 0, 1)
+    if raw:
+        # Distances are mapped to coverage at runtime
+        return np.round(normalized_sdf * 255).astype(np.uint8)
+    normalized_sdf = smoothstep(edge0, edge1, normalized_sdf) * 255
+    return normalized_sdf.astype(np.uint8)
+
+
+def parse_char_set(pattern: str) -> list[str]:
+    chars = []
+    last = None
 
-    def compute_sdf(bitmap, edge0, edge1):
-        inside = distance_transform_edt(bitmap)
-        outside = distance_transform_edt(1 - bitmap)
-        sdf = inside - outside
-        normalized_sdf = np.clip((sdf + 3) / 6, 0, 1)
-        normalized_sdf = smoothstep(edge0, edge1, normalized_sdf) * 255
-        return normalized_sdf.astype(np.uint8)
-
-    def parse_char_set(pattern: str) -> list[str]:
-        chars = []
-        last = None
-
-        i = 0
-        while i < len(pattern):
-            c = pattern[i]
-
-            if c == '-' and last is not None and i + 1 < len(pattern):
-                start = ord(last)
-                end = ord(pattern[i + 1])
+    i = 0
+    while i < len(pattern):
+        c = pattern[i]
 
-                if start < end:
-                    chars.extend(chr(code) for code in
-                                 range(start + 1, end + 1))
+        if c == '-' and last is not None and i + 1 < len(pattern):
+            start = ord(last)
+            end = ord(pattern[i + 1])
 
-                last = pattern[i + 1]
-                chars.append(last)
-                i += 2
-                continue
-            else:
-                chars.append(c)
-                last = c
+            if start < end:
+                chars.extend(chr(code) for code in
+                             range(start + 1, end + 1))
 
-            i += 1
-
-        return sorted(set(chars))
+            last = pattern[i + 1]
+            chars.append(last)
+            i += 2
+            continue
+        else:
+            chars.append(c)
+            last = c
 
-    sdf_datas = []
-    glyph_metadatas = []
+        i += 1
 
+    return sorted(set(chars))
+
+
+@functools.lru_cache(maxsize=None)
+def load_font(path, size):
+    return ImageFont.truetype(path, size)
+
+
+def font_height(path, size):
+    ascent, descent = load_font(path, size).getmetrics()
+    return ascent + descent
+
+
+@functools.lru_cache(maxsize=None)
+def hash_file(path):
+    return hashlib.sha256(Path(path).read_bytes()).hexdigest()
+
+
+def rasterize_glyph(job):
+    """Renders, transforms and encodes a single glyph.
+
+    Runs in the worker processes, so it only depends on its arguments.
+    Returns the encoded data, the width and the height of the glyph.
+    """
+    path, size, edges, layout, char = job
+    font = load_font(path, size)
+    ascent, descent = font.getmetrics()
+
+    bbox = font.getbbox(char, anchor="ls")
+    char_width = bbox[2] - bbox[0]
+
+    image = Image.new("L", (char_width, ascent + descent), 0)
+    draw = ImageDraw.Draw(image)
+    draw.text((-bbox[0], ascent), char, fill=255, font=font, anchor="ls")
+
+    bitmap = np.array(image) > 128
+    sdf = compute_sdf(bitmap, edges[0], edges[1], layout == "sdf")
+    sdf_image = Image.fromarray(sdf)
+
+    width, height = sdf_image.size
+    pixels = list(sdf_image.getdata())
+    if layout == "sdf":
+        data = pixels
+    elif layout == "rle_rows":
+        data = compress_rle_rows(pixels, width, height)
+    else:
+        compressed = compress_rle_4bit_paired(pixels)
+        data = [item for pair in compressed for item in pair]
+    return bytes(data), width, height
+
+
+def rle_pixel_count(data):
+    """Counts the pixels of (values, count1, count2) RLE triples."""
+    return sum(data[1::3]) + sum(data[2::3])
+
+
+def glyph_data_valid(data, width, height, layout):
+    """Checks that encoded glyph data covers exactly its width and height.
+
+    Mirrors the checks of the font pack loader, so that a truncated or
+    corrupted glyph cache entry is rendered again instead of being used.
+    """
+    if layout == "sdf":
+        return len(data) == width * height
+    if layout == "rle_rows":
+        if height == 0:
+            return len(data) == 0
+        if len(data) < 2 * height:
+            return False
+        offsets = [data[2 * y] | (data[2 * y + 1] << 8)
+                   for y in range(height)] + [len(data)]
+        if offsets[0] != 2 * height:
+            return False
+        for y in range(height):
+            row = data[offsets[y]:offsets[y + 1]]
+            if (offsets[y + 1] < offsets[y] or len(row) % 3
+                    or rle_pixel_count(row) > width):
+                return False
+        return True
+    return len(data) % 3 == 0 and rle_pixel_count(data) == width * height
+
+
+class GlyphCache:
+    """Content-addressed storage of encoded glyphs.
+
+    Glyphs are keyed on everything their data depends on: the hash of the
+    font file, the font size, the edges, the layout, the character and the
+    version of the encoding, so that editing fonts.json only renders the
+    glyphs that changed. Files are written atomically, so that concurrent
+    builds can share the same directory. Entries whose data does not match
+    their width and height are treated as missing and written again.
+    """
+
+    def __init__(self, directory):
+        self.directory = directory
+        self.hits = 0
+        self.misses = 0
+
+    def key(self, job):
+        path, size, edges, layout, char = job
+        description = json.dumps([GLYPH_CACHE_VERSION, hash_file(path), size,
+                                  list(edges), layout, char])
+        return hashlib.sha256(description.encode()).hexdigest()
+
+    def path(self, key):
+        return self.directory / key[:2] / key
+
+    def get(self, job):
+        if self.directory is None:
+            return None
+        try:
+            content = self.path(self.key(job)).read_bytes()
+        except OSError:
+            return None
+        if len(content) < 4:
+            return None
+        width, height = struct.unpack("<HH", content[:4])
+        data = content[4:]
+        if not glyph_data_valid(data, width, height, job[3]):
+            return None
+        self.hits += 1
+        return data, width, height
+
+    def put(self, job, glyph):
+        if self.directory is None:
+            return
+        data, width, height = glyph
+        path = self.path(self.key(job))
+        path.parent.mkdir(parents=True, exist_ok=True)
+        temporary = path.with_suffix(f".{os.getpid()}.tmp")
+        temporary.write_bytes(struct.pack("<HH", width, height) + data)
+        os.replace(temporary, path)
+
+
+def rasterize_glyphs(jobs, cache, workers):
+    """Encodes every glyph, taking the ones already done from the cache.
+
+    Glyphs missing from the cache are spread over worker processes.
+    """
+    glyphs = [cache.get(job) for job in jobs]
+    missing = [i for i, glyph in enumerate(glyphs) if glyph is None]
+    cache.misses += len(missing)
+
+    if workers > 1 and len(missing) > 1:
+        with ProcessPoolExecutor(max_workers=workers) as pool:
+            results = pool.map(rasterize_glyph, [jobs[i] for i in missing],
+                               chunksize=max(1, len(missing) // (4 * workers)))
+            for i, glyph in zip(missing, results):
+                glyphs[i] = glyph
+    else:
+        for i in missing:
+            glyphs[i] = rasterize_glyph(jobs[i])
+
+    for i in missing:
+        cache.put(jobs[i], glyphs[i])
+    return glyphs
+
+
+def glyph_jobs(font_json, size, characters):
+    path = os.path.join(json_base, font_json["font"])
+    return [(path, size, tuple(font_json["edges"]),
+             font_json.get("layout", "rle"), char) for char in characters]
+
+
+def assemble_level(font_json, size, characters, glyphs):
+    """Concatenates the glyphs of a level into its data and metadata."""
+    font_sdf_data = []
+    font_glyph_metadata = []
+
+    for char, (data, width, height) in zip(characters, glyphs):
+        if len(data) > 0xFFFF:
+            raise ValueError(f"glyph {char!r} of {font_json['name']} "
+                             "has more than 65535 bytes of data")
+        offset = len(font_sdf_data)
+        font_sdf_data.extend(data)
+        code = ord(char)
+        if char == '\'':
+            char = '\\' + char
+        font_glyph_metadata.append(
+            (offset, len(data), width, height, char, code))
+
+    path = os.path.join(json_base, font_json["font"])
+    return font_sdf_data, font_glyph_metadata, font_height(path, size)
+
+
+def generate_bitmaps(fonts, cache, workers):
+    # Level sizes only need the font metrics, so every glyph of every level
+    # is known before rendering any of them
+    plans = []
     for font_json in fonts:
-        font = ImageFont.truetype(os.path.join(json_base, font_json["font"]),
-                                  font_json["size"])
-
-        ascent, descent = font.getmetrics()
-        total_height = ascent + descent
-
-        font_sdf_data = []
-        font_glyph_metadata = []
-
+        path = os.path.join(json_base, font_json["font"])
         characters = parse_char_set(font_json["characters"])
+        master_height = font_height(path, font_json["size"])
 
-        for char in characters:
-            bbox = font.getbbox(char, anchor="ls")
-            char_width = bbox[2] - bbox[0]
-
-            image = Image.new("L", (char_width, total_height), 0)
-            draw = ImageDraw.Draw(image)
-
-            x_offset = -bbox[0]
-            y_offset = ascent
-            draw.text((x_offset, y_offset), char, fill=255,
-                      font=font, anchor="ls")
-
-            bitmap = np.array(image) > 128
-            sdf = compute_sdf(bitmap, font_json["edges"][0],
-                              font_json["edges"][1])
-            sdf_image = Image.fromarray(sdf)
-
-            width, height = sdf_image.size
-            pixels = list(sdf_image.getdata())
-            compressed = compress_rle_4bit_paired(pixels)
-            offset = len(font_sdf_data)
-
-            # Append SDF data
-            font_sdf_data.extend([item for pair in compressed
-                                  for item in pair])
-            if char == '\'':
-                char = '\\' + char
-            font_glyph_metadata.append(
-                (offset, len(compressed) * 3, width, height, char))
-
-        sdf_datas.append(font_sdf_data)
-        glyph_metadatas.append(font_glyph_metadata)
-
-    return sdf_datas, glyph_metadatas
+        # Extra pixel heights, rasterized at the smallest font size at least
+        # that tall, so that the runtime only scales glyphs down
+        sizes = {}
+        for target in font_json.get("sizes", []):
+            if target >= master_height:
+                continue
+            size = max(1, round(font_json["size"] * target / master_height))
+            while font_height(path, size) < target:
+                size += 1
+            while size > 1 and font_height(path, size - 1) >= target:
+                size -= 1
+            height = font_height(path, size)
+            if height < master_height:
+                sizes[height] = size
+        plans.append((font_json, characters,
+                      [sizes[h] for h in sorted(sizes)] + [font_json["size"]]))
+
+    jobs = [job for font_json, characters, sizes in plans for size in sizes
+            for job in glyph_jobs(font_json, size, characters)]
+    glyphs = iter(rasterize_glyphs(jobs, cache, workers))
+
+    levels = []
+    for font_json, characters, sizes in plans:
+        levels.append([
+            assemble_level(font_json, size, characters,
+                           [next(glyphs) for _ in characters])
+            for size in sizes
+        ])
+    return levels
+
+
+def build_glyph_index(glyphs):
+    if len(glyphs) >= GLYPH_INDEX_NONE:
+        raise ValueError(f"at most {GLYPH_INDEX_NONE} glyphs per font are "
+                         "supported")
+    index = [GLYPH_INDEX_NONE] * 256
+    for i, g in enumerate(glyphs):
+        if g["code"] > 255:
+            raise ValueError(f"character {chr(g['code'])!r} does not fit in "
+                             "a char")
+        index[g["code"]] = i
+    return index
+
+
+def generate_pack(fonts, path, logger):
+    """Writes the fonts to a binary font pack, read by font_api_pack_load.
+
+    Every value is little endian and every offset is from the start of the
+    pack. The header holds the magic, the version, the number of fonts and
+    the size of the pack, followed by a 32 bytes record per font: NUL padded
+    name, size, format, number of levels, edges, number of glyphs and the
+    offsets of the glyph index and of the level records. Level records hold
+    the height and the offsets of the glyphs and of the glyph data. Glyphs
+    have the layout of struct Glyph, so that they are used in place.
+    """
+    def align(data):
+        data.extend(b"\0" * (-len(data) % 4))
+
+    body = bytearray()
+    body_offset = 16 + 32 * len(fonts)
+    records = bytearray()
+    for font in fonts:
+        name = font["name"].encode()
+        if len(name) >= PACK_NAME_SIZE:
+            raise ValueError(f"{font['name']}: pack names are at most "
+                             f"{PACK_NAME_SIZE - 1} bytes long")
+
+        index_offset = body_offset + len(body)
+        body.extend(font["index"])
+        align(body)
+
+        level_records = bytearray()
+        for level in font["levels"]:
+            glyphs_offset = body_offset + len(body)
+            for g in level["glyphs"]:
+                body.extend(struct.pack("<c3xIHHH2x", chr(g["code"]).encode(
+                    "latin-1"), g["offset"], g["size"], g["width"],
+                    g["height"]))
+            data_offset = body_offset + len(body)
+            body.extend(bytes(level["sdfs"]))
+            align(body)
+            level_records.extend(struct.pack("<H2xIII", level["height"],
+                                             glyphs_offset, data_offset,
+                                             len(level["sdfs"])))
+
+        levels_offset = body_offset + len(body)
+        body.extend(level_records)
+        records.extend(struct.pack(
+            f"<{PACK_NAME_SIZE}sHBB2BHII", name, font["size"],
+            LAYOUTS.index(font.get("layout", "rle")), len(font["levels"]),
+            *font["edge_values"], len(font["glyphs"]), index_offset,
+            levels_offset))
+
+    size = body_offset + len(body)
+    header = struct.pack("<4sHHI4x", PACK_MAGIC, PACK_VERSION, len(fonts),
+                         size)
+    with open(path, "wb") as pack_file:
+        pack_file.write(header + records + body)
+    logger.info(f"Generated {path} ({size} bytes)")
 
 
 def generate_c_files(fonts, logger):
@@ -159,26 +454,61 @@ def main():
     logger = logging.getLogger("font-generator")
     logging.basicConfig(encoding='utf-8', level=logging.INFO)
 
-    with open(os.path.join(json_base, "fonts.json")) as json_data:
+    with open(args.json) as json_data:
         fonts = json.load(json_data)
 
+        names = set()
+        for font in fonts:
+            # Level symbols are "{name}__{height}", so a double underscore
+            # could make them collide with another font
+            if (not re.fullmatch(r"[A-Za-z][A-Za-z0-9_]*", font["name"])
+                    or "__" in font["name"] or font["name"].endswith("_")):
+                raise ValueError(f"{font['name']}: name must be a C "
+                                 "identifier without double underscores")
+            if font["name"].upper() in names:
+                raise ValueError(f"{font['name']}: name is used twice")
+            names.add(font["name"].upper())
+            if font.get("layout", "rle") not in LAYOUTS:
+                raise ValueError(f"{font['name']}: layout must be one of "
+                                 f"{', '.join(LAYOUTS)}")
+
         logger.info("bitmap generation")
-        sdfs, glyphs = generate_bitmaps(fonts)
+        cache = GlyphCache(None if args.no_cache else
+                           args.cache or json_base / ".glyph-cache")
+        levels = generate_bitmaps(fonts, cache, max(1, args.jobs))
+        logger.info(f"glyphs: {cache.hits} cached, {cache.misses} rendered")
         for i, font in enumerate(fonts):
-            font["sdfs"] = sdfs[i]
-            font["glyphs"] = [
+            font["format"] = "FONT_FORMAT_" + font.get("layout", "rle").upper()
+            font["edge_values"] = [round(edge * 255) for edge in font["edges"]]
+            font["levels"] = [
                 {
-                    "offset": g[0],
-                    "size": g[1],
-                    "width": g[2],
-                    "height": g[3],
-                    "char": g[4]
+                    "name": (font["name"] if level is levels[i][-1]
+                             else f"{font['name']}__{level[2]}"),
+                    "height": level[2],
+                    "sdfs": level[0],
+                    "glyphs": [
+                        {
+                            "offset": g[0],
+                            "size": g[1],
+                            "width": g[2],
+                            "height": g[3],
+                            "char": g[4],
+                            "code": g[5]
+                        }
+                        for g in level[1]
+                    ]
                 }
-                for g in glyphs[i]
+                for level in levels[i]
             ]
+            font["glyphs"] = font["levels"][-1]["glyphs"]
+            font["index"] = build_glyph_index(font["glyphs"])
+            logger.info(f"{font['name']}: glyph heights "
+                        f"{[level['height'] for level in font['levels']]}")
 
         logger.info("C and H generation")
         generate_c_files(fonts, logger)
+        if args.pack is not None:
+            generate_pack(fonts, args.pack, logger)
 
         logger.info("ok")
 